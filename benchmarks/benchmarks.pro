@@ -0,0 +1,10 @@
+TEMPLATE = subdirs
+
+# Micro-benchmarks (QtTest QBENCHMARK). Saída legível por máquina:
+#   ./codec -o resultado.xml,xml      (ou -o -,csv)
+#   ./paint -o resultado.xml,xml      (QT_QPA_PLATFORM=offscreen por padrão)
+# Compare sempre contra um baseline gerado no mesmo host.
+
+SUBDIRS += \
+    codec \
+    paint
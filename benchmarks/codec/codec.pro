@@ -0,0 +1,29 @@
+QT       += core network testlib
+QT       -= gui
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+TARGET = codec
+TEMPLATE = app
+
+# Codec OSC do app: empacotamento, encode/envio, parse de RX, descoberta e meters
+ROOT = $$PWD/../..
+INCLUDEPATH += $$ROOT
+
+SOURCES += \
+    tst_codec.cpp \
+    $$ROOT/metrics.cpp \
+    $$ROOT/osccapture.cpp \
+    $$ROOT/oscclient.cpp \
+    $$ROOT/rtttracker.cpp \
+    $$ROOT/trace.cpp
+
+HEADERS += \
+    $$ROOT/meterdecode.h \
+    $$ROOT/metrics.h \
+    $$ROOT/mixermodel.h \
+    $$ROOT/osccapture.h \
+    $$ROOT/oscclient.h \
+    $$ROOT/rtttracker.h \
+    $$ROOT/trace.h
@@ -0,0 +1,230 @@
+#include <QtTest>
+#include <QtEndian>
+#include "oscclient.h"
+#include "meterdecode.h"
+
+/*
+ * Benchmarks do codec OSC
+ * - Empacotamento (packString/packInt32/packFloat) e mensagem completa (encode)
+ * - Caminho de envio real (setChannelFader -> socket em 127.0.0.1)
+ * - Parse de RX via ingest(): mensagem simples, bundle e blobs de meter
+ * - Resposta de descoberta e conversão dB -> %
+ *
+ * Saída para comparar com baseline: ./codec -o resultado.xml,xml  (ou -o -,csv)
+ */
+
+// ====== Helpers ======
+static QByteArray blobArg(const QByteArray& payload)
+{
+    QByteArray b = OscClient::packInt32(payload.size()) + payload;
+    while (b.size() % 4) b.append('\0');
+    return b;
+}
+
+// Blob como o mixer manda: u32 BE (bytes) + int16 BE em dB*256
+static QByteArray meterPayload(int values)
+{
+    QByteArray p(4 + values * 2, Qt::Uninitialized);
+    qToBigEndian<quint32>(quint32(values * 2), p.data());
+    for (int i = 0; i < values; ++i) {
+        const qint16 v = qint16((-60 + (i * 7) % 60) * 256);
+        qToBigEndian<qint16>(v, p.data() + 4 + i * 2);
+    }
+    return p;
+}
+
+// X32/M32: int32 LE (nº de valores) + floats LE lineares
+static QByteArray meterPayloadX32(int values)
+{
+    QByteArray p(4 + values * 4, Qt::Uninitialized);
+    qToLittleEndian<qint32>(values, p.data());
+    for (int i = 0; i < values; ++i)
+        qToLittleEndian<float>(std::pow(10.0f, (-60 + (i * 7) % 60) / 20.0f), p.data() + 4 + i * 4);
+    return p;
+}
+
+static QByteArray bundleOf(const QList<QByteArray>& msgs)
+{
+    QByteArray b("#bundle", 8);              // inclui o '\0'
+    b.append(QByteArray(8, '\0'));          // timetag
+    for (const QByteArray& m : msgs)
+        b += OscClient::packInt32(m.size()) + m;
+    return b;
+}
+
+class CodecBench : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    // ====== Empacotamento ======
+    void packString_data();
+    void packString();
+    void packInt32();
+    void packFloat();
+    void encode_data();
+    void encode();
+    void sendFader();
+
+    // ====== Recepção ======
+    void ingest_data();
+    void ingest();
+
+    // ====== Descoberta / meters ======
+    void discoveryReply();
+    void meterBlob_data();
+    void meterBlob();
+    void profileMeters_data();
+    void profileMeters();
+    void meterDbToPct();
+
+private:
+    OscClient m_client;
+    quint64   m_received = 0;
+};
+
+void CodecBench::initTestCase()
+{
+    // Alvo local: os datagramas saem de verdade, sem precisar de mixer
+    QVERIFY(m_client.open(0));
+    m_client.setTarget(QHostAddress::LocalHost, 10024);
+    connect(&m_client, &OscClient::oscMessageReceived, this,
+            [this](const QString&, const QVariantList&) { ++m_received; });
+}
+
+// ====== Empacotamento ======
+void CodecBench::packString_data()
+{
+    QTest::addColumn<QString>("s");
+    QTest::newRow("xinfo")  << QStringLiteral("/xinfo");
+    QTest::newRow("fader")  << QStringLiteral("/ch/01/mix/fader");
+    QTest::newRow("name32") << QString(32, QChar('n'));
+}
+
+void CodecBench::packString()
+{
+    QFETCH(QString, s);
+    QBENCHMARK { QByteArray r = OscClient::packString(s); Q_UNUSED(r) }
+}
+
+void CodecBench::packInt32()
+{
+    qint32 v = 0;
+    QBENCHMARK { QByteArray r = OscClient::packInt32(++v); Q_UNUSED(r) }
+}
+
+void CodecBench::packFloat()
+{
+    float v = 0.0f;
+    QBENCHMARK { QByteArray r = OscClient::packFloat(v += 0.001f); Q_UNUSED(r) }
+}
+
+void CodecBench::encode_data()
+{
+    QTest::addColumn<QString>("address");
+    QTest::addColumn<QByteArray>("tags");
+    QTest::addColumn<QList<QByteArray>>("args");
+    QTest::newRow("fader") << QStringLiteral("/ch/01/mix/fader") << QByteArray("f")
+                           << QList<QByteArray>{ OscClient::packFloat(0.75f) };
+    QTest::newRow("mute")  << QStringLiteral("/ch/01/mix/on") << QByteArray("i")
+                           << QList<QByteArray>{ OscClient::packInt32(1) };
+    QTest::newRow("get")   << QStringLiteral("/ch/01/mix/fader") << QByteArray("s")
+                           << QList<QByteArray>{ OscClient::packString("?") };
+}
+
+void CodecBench::encode()
+{
+    QFETCH(QString, address);
+    QFETCH(QByteArray, tags);
+    QFETCH(QList<QByteArray>, args);
+    QBENCHMARK { QByteArray r = OscClient::encode(address, tags, args); Q_UNUSED(r) }
+}
+
+void CodecBench::sendFader()
+{
+    int ch = 0;
+    QBENCHMARK { m_client.setChannelFader(1 + (ch++ % 32), 0.5f); }
+}
+
+// ====== Recepção ======
+void CodecBench::ingest_data()
+{
+    QTest::addColumn<QByteArray>("datagram");
+    const QByteArray fader = OscClient::encode("/ch/01/mix/fader", "f", { OscClient::packFloat(0.5f) });
+    const QByteArray name  = OscClient::encode("/ch/01/config/name", "s", { OscClient::packString("Vocal") });
+
+    QTest::newRow("fader")  << fader;
+    QTest::newRow("name")   << name;
+    QTest::newRow("bundle8") << bundleOf({ fader, name, fader, name, fader, name, fader, name });
+    for (int n : { 16, 32, 96, 1024 }) {     // 16 = menor banco aceito (perfil Unknown)
+        QTest::newRow(qPrintable(QStringLiteral("meters1-%1").arg(n)))
+            << OscClient::encode("/meters/1", "b", { blobArg(meterPayload(n)) });
+    }
+}
+
+void CodecBench::ingest()
+{
+    QFETCH(QByteArray, datagram);
+    const quint64 before = m_received;
+    QBENCHMARK { m_client.ingest(datagram); }
+    QVERIFY(m_received > before);
+}
+
+// ====== Descoberta / meters ======
+void CodecBench::discoveryReply()
+{
+    const QByteArray d = OscClient::encode("/-prefs/name", "s", { OscClient::packString("XR18-5E-91-3A") });
+    QCOMPARE(OscClient::discoveryReplyAddress(d), QStringLiteral("/-prefs/name"));
+    QBENCHMARK { QString a = OscClient::discoveryReplyAddress(d); Q_UNUSED(a) }
+}
+
+void CodecBench::meterBlob_data()
+{
+    QTest::addColumn<int>("values");
+    for (int n : { 2, 8, 32, 96, 1024 })
+        QTest::newRow(qPrintable(QString::number(n))) << n;
+}
+
+void CodecBench::meterBlob()
+{
+    QFETCH(int, values);
+    const QByteArray raw = meterPayload(values);
+    std::vector<int> pct(size_t(values), 0);
+    QCOMPARE(meterBlobToPercent(raw, pct.data(), values), values);
+    QBENCHMARK { meterBlobToPercent(raw, pct.data(), values); }
+}
+
+// Decoder do perfil (tamanho fixo pelo modelo) vs meterBlobToPercent acima
+void CodecBench::profileMeters_data()
+{
+    QTest::addColumn<int>("model");
+    QTest::newRow("XR12") << int(MixerModel::XR12);
+    QTest::newRow("XR18") << int(MixerModel::XR18);
+    QTest::newRow("X32")  << int(MixerModel::X32);
+}
+
+void CodecBench::profileMeters()
+{
+    QFETCH(int, model);
+    const MixerProfile& prof = mixerProfile(MixerModel(model));
+    const int n = prof.caps->meterCh.count;
+    const QByteArray raw = prof.caps->meterFormat == MeterFormat::FloatLE ? meterPayloadX32(n)
+                                                                          : meterPayload(n);
+    int pct[kMixerMaxChannels];
+    QVERIFY(prof.acceptChannelMeters(raw));
+    QBENCHMARK { prof.channelMeters(raw, pct, n); }
+}
+
+void CodecBench::meterDbToPct()
+{
+    int acc = 0;
+    QBENCHMARK {
+        for (int i = -8000; i <= 0; i += 50) acc += ::meterDbToPct(i / 100.0f);
+    }
+    QVERIFY(acc > 0);
+}
+
+QTEST_GUILESS_MAIN(CodecBench)
+#include "tst_codec.moc"
@@ -0,0 +1,28 @@
+QT       += core gui widgets testlib
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+TARGET = paint
+TEMPLATE = app
+
+# Custo de pintura dos widgets Modern* (renderização offscreen em QImage)
+ROOT = $$PWD/../..
+INCLUDEPATH += $$ROOT
+
+SOURCES += \
+    tst_paint.cpp \
+    $$ROOT/modernbutton.cpp \
+    $$ROOT/moderncombobox.cpp \
+    $$ROOT/moderndial.cpp \
+    $$ROOT/modernprogressbar.cpp \
+    $$ROOT/osccbstyle.cpp \
+    $$ROOT/trace.cpp
+
+HEADERS += \
+    $$ROOT/modernbutton.h \
+    $$ROOT/moderncombobox.h \
+    $$ROOT/moderndial.h \
+    $$ROOT/modernprogressbar.h \
+    $$ROOT/osccbstyle.h \
+    $$ROOT/trace.h
@@ -0,0 +1,439 @@
+#include <QtTest>
+#include <QApplication>
+#include <QImage>
+#include <QHBoxLayout>
+#include <QVBoxLayout>
+#include <QProgressBar>
+#include <QPainter>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+
+#include "moderndial.h"
+#include "modernprogressbar.h"
+#include "modernbutton.h"
+#include "moderncombobox.h"
+#include "osccbstyle.h"
+
+/*
+ * Benchmarks de pintura dos widgets Modern*
+ * - Cada widget é renderizado num QImage (QWidget::render), sem janela:
+ *   roda com QT_QPA_PLATFORM=offscreen (padrão se a variável não existir)
+ * - Linhas: tamanho x DPR x valor; valor -1 = muda a cada frame (carga real)
+ * - 17 barras (16 canais + LR, como na UI): ModernProgressBar atual contra a
+ *   pintura de antes do cache de faixas (LegacyProgressBar, cópia do paintEvent
+ *   antigo); render() repinta tudo, então só o ganho do cache aparece aqui
+ *   (o repaint parcial por gomo soma por cima no app)
+ * - Página de mixer com 8/16/32 strips: a cada frame todos os meters mudam
+ *   (1 frame = 1 tick de 30 Hz; orçamento = 33,3 ms) e a página inteira é
+ *   repintada (pior caso: o app só repinta o que mudou)
+ * - Cada caso roda 3 vezes (dado global "measure"):
+ *     time   -> ms por pintura (QBENCHMARK)
+ *     allocs -> alocações por pintura (Events)
+ *     bytes  -> bytes alocados por pintura (BytesAllocated)
+ *
+ * O DPR da linha vai no QImage (escala do painter). Os caches internos dos
+ * widgets seguem o DPR da tela: para medi-los em 2x, rode com QT_SCALE_FACTOR=2.
+ *
+ * Saída para comparar com baseline: ./paint -o resultado.xml,xml  (ou -o -,csv)
+ */
+
+// ====== Contagem de alocações ======
+static std::atomic<quint64> g_allocs{0};
+static std::atomic<quint64> g_allocBytes{0};
+
+static inline void countAlloc(size_t n)
+{
+    g_allocs.fetch_add(1, std::memory_order_relaxed);
+    g_allocBytes.fetch_add(n, std::memory_order_relaxed);
+}
+
+#if defined(__GLIBC__)
+// glibc: intercepta o malloc do processo inteiro (QArrayData, QImage e o
+// operator new da libstdc++ passam todos por aqui)
+extern "C" {
+void* __libc_malloc(size_t);
+void* __libc_calloc(size_t, size_t);
+void* __libc_realloc(void*, size_t);
+
+void* malloc(size_t n)             { countAlloc(n); return __libc_malloc(n); }
+void* calloc(size_t c, size_t n)   { countAlloc(c * n); return __libc_calloc(c, n); }
+void* realloc(void* p, size_t n)   { if (n) countAlloc(n); return __libc_realloc(p, n); }
+}
+#else
+// Outras plataformas: só o operator new (containers do Qt usam malloc direto
+// e ficam de fora — compare apenas resultados da mesma plataforma)
+void* operator new(size_t n)
+{
+    countAlloc(n);
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](size_t n)                 { return operator new(n); }
+void  operator delete(void* p) noexcept         { std::free(p); }
+void  operator delete[](void* p) noexcept       { std::free(p); }
+void  operator delete(void* p, size_t) noexcept   { std::free(p); }
+void  operator delete[](void* p, size_t) noexcept { std::free(p); }
+#endif
+
+// ====== Medição ======
+static constexpr int kAllocFrames = 200;
+
+// Pinta w num QImage (tamanho lógico x dpr); step(frame) roda antes de cada pintura
+template <typename Step>
+static void measurePaint(QWidget& w, qreal dpr, Step step)
+{
+    QFETCH_GLOBAL(QString, measure);
+
+    QImage img(w.size() * dpr, QImage::Format_ARGB32_Premultiplied);
+    img.setDevicePixelRatio(dpr);
+    img.fill(Qt::transparent);
+
+    int frame = 0;
+    step(frame++);
+    w.render(&img);                       // aquece caches (pixmaps, fontes, layout)
+
+    if (measure == QLatin1String("time")) {
+        QBENCHMARK { step(frame++); w.render(&img); }
+        return;
+    }
+
+    const quint64 n0 = g_allocs.load(), b0 = g_allocBytes.load();
+    for (int i = 0; i < kAllocFrames; ++i) { step(frame++); w.render(&img); }
+    const quint64 n1 = g_allocs.load(), b1 = g_allocBytes.load();
+
+    if (measure == QLatin1String("allocs"))
+        QTest::setBenchmarkResult(qreal(n1 - n0) / kAllocFrames, QTest::Events);
+    else
+        QTest::setBenchmarkResult(qreal(b1 - b0) / kAllocFrames, QTest::BytesAllocated);
+}
+
+// ====== ModernProgressBar antes do cache (referência) ======
+// paintEvent original: trilho + preenchimento arredondados, gomo a gomo, a cada pintura
+class LegacyProgressBar : public QProgressBar
+{
+public:
+    using QProgressBar::QProgressBar;
+
+protected:
+    void paintEvent(QPaintEvent*) override
+    {
+        QPainter p(this);
+        p.setRenderHint(QPainter::Antialiasing, true);
+
+        const QRectF R = QRectF(rect()).adjusted(kPadding, kPadding, -kPadding, -kPadding);
+        if (R.width() <= 0 || R.height() <= 0) return;
+
+        const double frac = qBound(0.0, double(value() - minimum()) / qMax(1, maximum() - minimum()), 1.0);
+        const bool vertical = (orientation() == Qt::Vertical);
+        const double totalSpacing = kSpacing * (kSegments - 1);
+        const double segLen = qMax(1.0, ((vertical ? R.height() : R.width()) - totalSpacing) / kSegments);
+
+        const double totalSegs = frac * kSegments;
+        const int full = int(std::floor(totalSegs + 1e-9));
+        const double part = totalSegs - full;
+
+        p.setPen(Qt::NoPen);
+        for (int i = 0; i < kSegments; ++i) {
+            const QRectF seg = vertical
+                ? QRectF(R.x(), R.bottom() - (i + 1) * segLen - i * kSpacing, R.width(), segLen)
+                : QRectF(R.x() + i * (segLen + kSpacing), R.y(), segLen, R.height());
+
+            p.setBrush(m_track);
+            p.drawRoundedRect(seg, kRadius, kRadius);
+
+            if (i < full) {
+                p.setBrush(m_fill);
+                p.drawRoundedRect(seg, kRadius, kRadius);
+            } else if (i == full && part > 0.0) {
+                QRectF partial = seg;
+                if (vertical) { partial.setY(seg.y() + (1.0 - part) * segLen); partial.setHeight(segLen * part); }
+                else          partial.setWidth(segLen * part);
+                p.setBrush(m_fill);
+                p.drawRoundedRect(partial, kRadius, kRadius);
+            }
+        }
+    }
+
+private:
+    // mesmos padrões do ModernProgressBar
+    static constexpr int kSegments = 20;
+    static constexpr int kSpacing  = 2;
+    static constexpr int kRadius   = 6;
+    static constexpr int kPadding  = 6;
+    const QColor m_track = QColor("#1e1e1e");
+    const QColor m_fill  = QColor("#00C853");
+};
+
+// Valor 0..100 do frame (-1 = varredura contínua)
+static inline int frameValue(int value, int frame)
+{
+    if (value >= 0) return value;
+    return 50 + int(std::lround(49.0 * std::sin(frame * 0.21)));
+}
+
+class PaintBench : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase_data();
+    void initTestCase();
+
+    void dial_data();
+    void dial();
+    void progressBar_data();
+    void progressBar();
+    void button_data();
+    void button();
+    void comboBox_data();
+    void comboBox();
+
+    void progressBars17_data();
+    void progressBars17();
+
+    void mixerPage_data();
+    void mixerPage();
+
+private:
+    static void addRows(const QList<QSize>& sizes, const QList<int>& values);
+};
+
+void PaintBench::initTestCase_data()
+{
+    QTest::addColumn<QString>("measure");
+    QTest::newRow("time")   << QStringLiteral("time");
+    QTest::newRow("allocs") << QStringLiteral("allocs");
+    QTest::newRow("bytes")  << QStringLiteral("bytes");
+}
+
+void PaintBench::initTestCase()
+{
+    // Mesmo tema do app (main.cpp)
+    auto* style = new OsccbStyle;
+    QApplication::setStyle(style);
+    QApplication::setPalette(style->standardPalette());
+}
+
+void PaintBench::addRows(const QList<QSize>& sizes, const QList<int>& values)
+{
+    QTest::addColumn<QSize>("size");
+    QTest::addColumn<qreal>("dpr");
+    QTest::addColumn<int>("value");
+
+    for (const QSize& s : sizes)
+        for (qreal dpr : { 1.0, 1.5, 2.0 })
+            for (int v : values) {
+                const QString tag = QStringLiteral("%1x%2@%3-%4")
+                                        .arg(s.width()).arg(s.height()).arg(dpr)
+                                        .arg(v < 0 ? QStringLiteral("sweep") : QString::number(v));
+                QTest::newRow(qPrintable(tag)) << s << dpr << v;
+            }
+}
+
+// ====== Widgets isolados ======
+void PaintBench::dial_data()
+{
+    addRows({ QSize(48, 48), QSize(96, 96), QSize(160, 160) }, { 0, 50, 100, -1 });
+}
+
+void PaintBench::dial()
+{
+    QFETCH(QSize, size);
+    QFETCH(qreal, dpr);
+    QFETCH(int, value);
+
+    ModernDial d;
+    d.setRange(0, 100);
+    d.resize(size);
+    measurePaint(d, dpr, [&](int frame) {
+        const int v = frameValue(value, frame);
+        d.setValue(v);
+        d.setProgress01(v / 100.0);
+    });
+}
+
+void PaintBench::progressBar_data()
+{
+    addRows({ QSize(200, 24), QSize(400, 32), QSize(24, 300) }, { 0, 50, 100, -1 });
+}
+
+void PaintBench::progressBar()
+{
+    QFETCH(QSize, size);
+    QFETCH(qreal, dpr);
+    QFETCH(int, value);
+
+    ModernProgressBar b;
+    b.setRange(0, 100);
+    b.setTextVisible(false);
+    if (size.height() > size.width()) b.setOrientation(Qt::Vertical);
+    b.resize(size);
+    measurePaint(b, dpr, [&](int frame) { b.setValue(frameValue(value, frame)); });
+}
+
+void PaintBench::button_data()
+{
+    // valor: 0 = normal, 100 = checked, -1 = alterna a cada frame
+    addRows({ QSize(48, 48), QSize(120, 40) }, { 0, 100, -1 });
+}
+
+void PaintBench::button()
+{
+    QFETCH(QSize, size);
+    QFETCH(qreal, dpr);
+    QFETCH(int, value);
+
+    ModernButton b;
+    b.setText(QStringLiteral("MUTE"));
+    b.setCheckable(true);
+    b.resize(size);
+    measurePaint(b, dpr, [&](int frame) {
+        b.setChecked(value < 0 ? (frame & 1) : value > 0);
+    });
+}
+
+void PaintBench::comboBox_data()
+{
+    // valor = item atual; -1 = troca a cada frame
+    addRows({ QSize(160, 32), QSize(280, 40) }, { 0, -1 });
+}
+
+void PaintBench::comboBox()
+{
+    QFETCH(QSize, size);
+    QFETCH(qreal, dpr);
+    QFETCH(int, value);
+
+    ModernComboBox c;
+    c.addItems({ QStringLiteral("XR18 — 192.168.1.43"),
+                 QStringLiteral("X32 — 192.168.1.50"),
+                 QStringLiteral("Emulador — 127.0.0.1") });
+    c.resize(size);
+    measurePaint(c, dpr, [&](int frame) {
+        c.setCurrentIndex(value < 0 ? frame % c.count() : value);
+    });
+}
+
+// ====== 17 barras: antes x depois do cache ======
+void PaintBench::progressBars17_data()
+{
+    QTest::addColumn<bool>("legacy");
+    QTest::addColumn<qreal>("dpr");
+    for (bool legacy : { true, false })
+        for (qreal dpr : { 1.0, 2.0 })
+            QTest::newRow(qPrintable(QStringLiteral("%1@%2").arg(legacy ? "legacy" : "cached").arg(dpr)))
+                << legacy << dpr;
+}
+
+void PaintBench::progressBars17()
+{
+    QFETCH(bool, legacy);
+    QFETCH(qreal, dpr);
+
+    static constexpr int kBars = 17;
+    QWidget page;
+    auto* row = new QHBoxLayout(&page);
+    QList<QProgressBar*> bars;
+    for (int i = 0; i < kBars; ++i) {
+        QProgressBar* b = legacy ? static_cast<QProgressBar*>(new LegacyProgressBar)
+                                 : new ModernProgressBar;
+        b->setOrientation(Qt::Vertical);
+        b->setRange(0, 100);
+        b->setTextVisible(false);
+        b->setFixedSize(24, 300);
+        row->addWidget(b);
+        bars << b;
+    }
+    page.resize(kBars * 30, 320);
+
+    // todas mudam a cada frame (meters a 30 Hz)
+    measurePaint(page, dpr, [&](int frame) {
+        for (int i = 0; i < bars.size(); ++i) {
+            bars[i]->setValue(frameValue(-1, frame + i * 3));
+        }
+    });
+}
+
+// ====== Página de mixer (strips) ======
+void PaintBench::mixerPage_data()
+{
+    QTest::addColumn<int>("strips");
+    QTest::addColumn<qreal>("dpr");
+    for (int n : { 8, 16, 32 })
+        for (qreal dpr : { 1.0, 2.0 })
+            QTest::newRow(qPrintable(QStringLiteral("%1ch@%2").arg(n).arg(dpr))) << n << dpr;
+}
+
+void PaintBench::mixerPage()
+{
+    QFETCH(int, strips);
+    QFETCH(qreal, dpr);
+
+    // Strip como no mainwindow.ui: dial, -/+, meter, fader e mute
+    QWidget page;
+    auto* row = new QHBoxLayout(&page);
+    QList<QProgressBar*> meters;
+
+    for (int ch = 0; ch < strips; ++ch) {
+        auto* col = new QVBoxLayout;
+
+        auto* dial = new ModernDial;
+        dial->setRange(0, 100);
+        dial->setFixedSize(64, 64);
+        col->addWidget(dial);
+
+        auto* steps = new QHBoxLayout;
+        for (const char* t : { "-", "+" }) {
+            auto* b = new ModernButton;
+            b->setText(QString::fromLatin1(t));
+            b->setFixedSize(30, 30);
+            steps->addWidget(b);
+        }
+        col->addLayout(steps);
+
+        auto* meter = new QProgressBar;
+        meter->setOrientation(Qt::Vertical);
+        meter->setRange(0, 100);
+        meter->setTextVisible(false);
+        meter->setMaximumWidth(20);
+        col->addWidget(meter, 1, Qt::AlignHCenter);
+        meters << meter;
+
+        auto* fader = new ModernProgressBar;
+        fader->setRange(0, 100);
+        fader->setTextVisible(false);
+        fader->setFixedHeight(24);
+        fader->setValue(70);
+        col->addWidget(fader);
+
+        auto* mute = new ModernButton;
+        mute->setText(QStringLiteral("M"));
+        mute->setCheckable(true);
+        mute->setFixedHeight(36);
+        col->addWidget(mute);
+
+        row->addLayout(col);
+    }
+    page.resize(strips * 72, 480);
+
+    // 1 frame = 1 tick de meter a 30 Hz: todos os canais mudam
+    measurePaint(page, dpr, [&](int frame) {
+        for (int ch = 0; ch < meters.size(); ++ch)
+            meters[ch]->setValue(frameValue(-1, frame + ch * 3));
+    });
+}
+
+int main(int argc, char* argv[])
+{
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    QApplication app(argc, argv);
+    PaintBench bench;
+    QTEST_SET_MAIN_SOURCE_PATH
+    return QTest::qExec(&bench, argc, argv);
+}
+
+#include "tst_paint.moc"
@@ -0,0 +1,33 @@
+QT       += core network
+QT       -= gui
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = osccb-cli
+TEMPLATE = app
+
+# Cliente headless (sem widgets) sobre o mesmo OscClient do app (ver main.cpp para uso)
+ROOT = $$PWD/..
+INCLUDEPATH += $$ROOT
+
+SOURCES += \
+    main.cpp \
+    $$ROOT/logbuffer.cpp \
+    $$ROOT/metrics.cpp \
+    $$ROOT/osccapture.cpp \
+    $$ROOT/oscclient.cpp \
+    $$ROOT/rtttracker.cpp \
+    $$ROOT/scenestore.cpp \
+    $$ROOT/trace.cpp
+
+HEADERS += \
+    $$ROOT/logbuffer.h \
+    $$ROOT/meterdecode.h \
+    $$ROOT/metrics.h \
+    $$ROOT/mixermodel.h \
+    $$ROOT/osccapture.h \
+    $$ROOT/oscclient.h \
+    $$ROOT/rtttracker.h \
+    $$ROOT/scenestore.h \
+    $$ROOT/trace.h
@@ -0,0 +1,277 @@
+#include "oscclient.h"
+#include "scenestore.h"
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QStandardPaths>
+#include <QTextStream>
+#include <QTimer>
+#include <QDir>
+#include <QMap>
+#include <QSet>
+
+/*
+ * osccb-cli — o mesmo OscClient do app, sem widgets (cron, ssh, automação)
+ *
+ *   osccb-cli discover [--cidr 192.168.1.0/24]
+ *   osccb-cli --ip 192.168.1.50 get /ch/01/mix/fader /lr/mix/on
+ *   osccb-cli --ip 192.168.1.50 set /ch/01/mix/fader 0.75     # 42 -> ,i  0.75 -> ,f  resto -> ,s
+ *   osccb-cli --ip 192.168.1.50 set --type f /lr/mix/fader 1  # força o tipo (1 seria ,i)
+ *   osccb-cli sync --channels 16                              # "endereço valor" por linha
+ *   osccb-cli scene ORACAO                                    # cena do profiles.ini do app
+ *   osccb-cli meters --lr --count 100                         # % por linha, como na UI
+ *   osccb-cli record culto.osccap --seconds 3600              # abre no app com --replay
+ *
+ * Sem --ip, descobre o mixer (broadcast /xinfo). Saída: 0 ok, 1 sem resposta/falha, 2 uso.
+ */
+
+static constexpr int kRenewMs = 8000;     // /meters expira em 10 s no console
+
+// Argumentos de uma mensagem como texto (blob vira só o tamanho)
+static QString formatArgs(const QVariantList& args)
+{
+    QStringList parts;
+    parts.reserve(args.size());
+    for (const QVariant& v : args) {
+        switch (v.typeId()) {
+        case QMetaType::Float:
+        case QMetaType::Double:    parts << QString::number(v.toDouble(), 'f', 4); break;
+        case QMetaType::QByteArray: parts << QString("<blob %1 bytes>").arg(v.toByteArray().size()); break;
+        case QMetaType::QString:   parts << '"' + v.toString() + '"'; break;
+        default:                   parts << v.toString(); break;
+        }
+    }
+    return parts.join(' ');
+}
+
+// Valor da linha de comando -> argumento OSC. type: 'i', 'f', 's' ou 0 (inferido
+// do texto: inteiro só sem '.'/'e'). Vazio = texto não serve para o tipo pedido.
+static QByteArray packValue(const QString& text, char type, QByteArray* tag)
+{
+    bool ok = false;
+    if (type == 0 || type == 'i') {
+        const int i = text.toInt(&ok);
+        if (ok) { *tag = "i"; return OscClient::packInt32(i); }
+        if (type) return {};
+    }
+    if (type == 0 || type == 'f') {
+        const float f = text.toFloat(&ok);
+        if (ok) { *tag = "f"; return OscClient::packFloat(f); }
+        if (type) return {};
+    }
+    *tag = "s";
+    return OscClient::packString(text);
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    // Mesmo AppDataLocation do app: "scene" lê o profiles.ini que a UI grava
+    QCoreApplication::setApplicationName("untitled");
+
+    QCommandLineParser cli;
+    cli.setApplicationDescription("Cliente OSC headless do OSCCB (X-Air/X32)");
+    cli.addHelpOption();
+    cli.addPositionalArgument("comando", "discover | get | set | sync | scene | meters | record");
+    cli.addPositionalArgument("args", "Argumentos do comando.", "[args...]");
+
+    const QCommandLineOption optIp      ("ip",       "IP do mixer (sem ele: descoberta).", "ip");
+    const QCommandLineOption optPort    ("port",     "Porta UDP do mixer (padrão 10024; X32 10023).", "porta", "10024");
+    const QCommandLineOption optCidr    ("cidr",     "Faixa da descoberta (padrão: todas as interfaces).", "cidr");
+    const QCommandLineOption optTimeout ("timeout",  "Espera por resposta em ms (padrão 1500).", "ms", "1500");
+    const QCommandLineOption optChannels("channels", "Canais em sync/meters (1..32, padrão 8).", "n", "8");
+    const QCommandLineOption optIni     ("ini",      "profiles.ini das cenas (padrão: o do app).", "arquivo");
+    const QCommandLineOption optLr      ("lr",       "meters: LR (/meters/3) em vez dos canais.");
+    const QCommandLineOption optCount   ("count",    "meters: para após N frames (0 = sem fim).", "n", "0");
+    const QCommandLineOption optSeconds ("seconds",  "record: duração da captura (padrão 60).", "s", "60");
+    const QCommandLineOption optType    ("type",     "set: tipo do valor (i, f ou s; padrão: pelo texto).", "tipo");
+    cli.addOptions({ optIp, optPort, optCidr, optTimeout, optChannels, optIni, optLr, optCount, optSeconds, optType });
+    cli.process(app);
+
+    const QStringList pos = cli.positionalArguments();
+    if (pos.isEmpty()) cli.showHelp(2);
+    const QString cmd     = pos.first();
+    const QStringList arg = pos.mid(1);
+    const int timeoutMs   = qMax(1, cli.value(optTimeout).toInt());
+    const int channels    = qBound(1, cli.value(optChannels).toInt(), kMixerMaxChannels);
+
+    QTextStream out(stdout);
+    OscClient osc;
+    QObject::connect(&osc, &OscClient::error, [](const QString& m) { qWarning("%s", qPrintable(m)); });
+    if (!osc.open()) return 1;
+
+    // ====== discover ======
+    if (cmd == QLatin1String("discover")) {
+        const QHostAddress found = cli.isSet(optCidr) ? osc.discoverMixerRange(cli.value(optCidr), timeoutMs)
+                                                      : osc.discoverOnAllIfaces(timeoutMs);
+        if (found.isNull()) { qCritical("nenhum mixer respondeu"); return 1; }
+        out << found.toString() << Qt::endl;
+        return 0;
+    }
+
+    // ====== Alvo ======
+    const quint16 port = quint16(cli.value(optPort).toUInt());
+    if (cli.isSet(optIp)) {
+        const QHostAddress ip(cli.value(optIp));
+        if (ip.isNull()) { qCritical("endereço inválido em --ip"); return 2; }
+        osc.setTarget(ip, port);
+    } else {
+        if (!osc.setTargetFromDiscovery(cli.value(optCidr), timeoutMs)) {
+            qCritical("nenhum mixer respondeu (use --ip)");
+            return 1;
+        }
+        if (cli.isSet(optPort)) osc.setTarget(osc.targetAddress(), port);   // senão, a porta que respondeu
+    }
+
+    auto usage = [&](int n, const char* what) {
+        if (arg.size() >= n) return true;
+        qCritical("uso: osccb-cli %s %s", qPrintable(cmd), what);
+        return false;
+    };
+
+    // ====== get <endereço>... ======
+    if (cmd == QLatin1String("get")) {
+        if (!usage(1, "<endereço>...")) return 2;
+        QSet<QString> waiting(arg.cbegin(), arg.cend());
+        QObject::connect(&osc, &OscClient::oscMessageReceived, &app,
+                         [&](const QString& addr, const QVariantList& args) {
+            if (!waiting.remove(addr)) return;
+            out << addr << ' ' << formatArgs(args) << Qt::endl;
+            if (waiting.isEmpty()) app.exit(0);
+        });
+        QTimer::singleShot(timeoutMs, &app, [&] {
+            for (const QString& a : std::as_const(waiting)) qWarning("sem resposta: %s", qPrintable(a));
+            app.exit(1);
+        });
+        osc.beginBundle();
+        for (const QString& a : arg) osc.sendRaw(OscClient::encode(a, "s", { OscClient::packString("?") }));
+        osc.endBundle();
+        return app.exec();
+    }
+
+    // ====== set <endereço> <valor> ======
+    if (cmd == QLatin1String("set")) {
+        if (!usage(2, "<endereço> <valor>")) return 2;
+        const QString type = cli.value(optType);
+        if (!type.isEmpty() && (type.size() != 1 || !QStringLiteral("ifs").contains(type))) {
+            qCritical("--type: i, f ou s");
+            return 2;
+        }
+        QByteArray tag;
+        const QByteArray value = packValue(arg.at(1), type.isEmpty() ? 0 : type.at(0).toLatin1(), &tag);
+        if (value.isEmpty()) {
+            qCritical("valor inválido para --type %s: %s", qPrintable(type), qPrintable(arg.at(1)));
+            return 2;
+        }
+        return osc.sendRaw(OscClient::encode(arg.at(0), tag, { value })) ? 0 : 1;
+    }
+
+    // ====== sync: fader/mute de 1..channels + LR ======
+    if (cmd == QLatin1String("sync")) {
+        QMap<QString, QString> state;     // ordenado por endereço
+        QTimer quiet;                     // termina após timeoutMs sem resposta nova
+        quiet.setSingleShot(true);
+        QObject::connect(&quiet, &QTimer::timeout, &app, [&] {
+            for (auto it = state.cbegin(); it != state.cend(); ++it) out << it.key() << ' ' << it.value() << '\n';
+            out.flush();
+            app.exit(state.isEmpty() ? 1 : 0);
+        });
+        QObject::connect(&osc, &OscClient::oscMessageReceived, &app,
+                         [&](const QString& addr, const QVariantList& args) {
+            if (addr == QLatin1String("/xremote") || addr.startsWith(QLatin1String("/meters"))) return;
+            state.insert(addr, formatArgs(args));
+            quiet.start(timeoutMs);
+        });
+        osc.syncAll(channels);
+        quiet.start(timeoutMs);
+        return app.exec();
+    }
+
+    // ====== scene <NOME>: recall do profiles.ini, num bundle (sem fade) ======
+    if (cmd == QLatin1String("scene")) {
+        if (!usage(1, "<NOME>")) return 2;
+        QString ini = cli.value(optIni);
+        if (ini.isEmpty()) {
+            const QString base = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+            ini = QDir(base).filePath("profiles.ini");
+        }
+        const SceneStore store(ini);
+        const QString name = arg.at(0);
+        if (name == QLatin1String("LABELS") || name == QLatin1String("CONFIG") || !store.hasGroup(name)) {
+            qCritical("cena inexistente em %s: %s", qPrintable(ini), qPrintable(name));
+            return 2;
+        }
+
+        const int snap = store.value(name, "snap", 0).toInt();
+        if (snap > 0) {
+            osc.loadSnapshot(snap);
+            out << "snapshot " << snap << Qt::endl;
+            return 0;
+        }
+
+        int sent = 0;
+        osc.beginBundle();
+        for (int ch = 0; ch < 32; ++ch) {
+            const QVariant m = store.value(name, QString("m%1").arg(ch));
+            const QVariant f = store.value(name, QString("f%1").arg(ch));
+            if (m.isValid()) { osc.setChannelMute(ch + 1, !m.toBool()); ++sent; }    // mixer: on = 1
+            if (f.isValid()) { osc.setChannelFader(ch + 1, qBound(0.0f, f.toFloat(), 1.0f)); ++sent; }
+        }
+        const QVariant mLR = store.value(name, "mLR");
+        const QVariant fLR = store.value(name, "fLR");
+        if (mLR.isValid()) { osc.setMainLRMute(!mLR.toBool()); ++sent; }
+        if (fLR.isValid()) { osc.setMainLRFader(qBound(0.0f, fLR.toFloat(), 1.0f)); ++sent; }
+        const bool ok = osc.endBundle();
+        out << sent << " parâmetros" << Qt::endl;
+        return ok ? 0 : 1;
+    }
+
+    // ====== meters: % por frame, como nas barras da UI ======
+    if (cmd == QLatin1String("meters")) {
+        const bool lr     = cli.isSet(optLr);
+        const int  n      = lr ? 2 : channels;
+        const int  count  = cli.value(optCount).toInt();
+        const QString want = lr ? QStringLiteral("/meters/3") : QStringLiteral("/meters/1");
+        int frames = 0;
+
+        QObject::connect(&osc, &OscClient::oscMessageReceived, &app,
+                         [&](const QString& addr, const QVariantList& args) {
+            if (addr != want || args.isEmpty()) return;
+            // o OscClient só emite blobs que o perfil aceitou; o formato é do modelo
+            const QByteArray raw = args.first().toByteArray();
+            int pct[kMixerMaxChannels];
+            if (lr) osc.profile().lrMeters(raw, pct);
+            else    osc.profile().channelMeters(raw, pct, n);
+            for (int i = 0; i < n; ++i) out << (i ? " " : "") << pct[i];
+            out << Qt::endl;
+            if (count > 0 && ++frames >= count) app.exit(0);
+        });
+        QTimer renew;
+        QObject::connect(&renew, &QTimer::timeout, &osc, &OscClient::renewMeterSubscriptions);
+        renew.start(kRenewMs);
+        if (lr) osc.subscribeMetersLR();
+        else    osc.subscribeMetersAllChannels();
+        return app.exec();
+    }
+
+    // ====== record <arquivo>: sessão completa (estado + meters) em .osccap ======
+    if (cmd == QLatin1String("record")) {
+        if (!usage(1, "<arquivo.osccap>")) return 2;
+        if (!osc.startRecording(arg.at(0))) return 1;
+
+        QTimer renew;
+        QObject::connect(&renew, &QTimer::timeout, &osc, &OscClient::renewMeterSubscriptions);
+        renew.start(kRenewMs);
+        osc.syncAll(channels);                 // também liga o /xremote
+        osc.subscribeMetersAllChannels();
+        osc.subscribeMetersLR();
+
+        QTimer::singleShot(qMax(1, cli.value(optSeconds).toInt()) * 1000, &app, &QCoreApplication::quit);
+        const int rc = app.exec();
+        osc.stopRecording();
+        return rc;
+    }
+
+    qCritical("comando desconhecido: %s", qPrintable(cmd));
+    return 2;
+}
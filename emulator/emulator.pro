@@ -0,0 +1,17 @@
+QT       += core network
+QT       -= gui
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = osccb-emulator
+TEMPLATE = app
+
+# Emulador headless de mixer X-Air/X32 (ver main.cpp para uso)
+
+SOURCES += \
+    main.cpp \
+    mixeremulator.cpp
+
+HEADERS += \
+    mixeremulator.h
@@ -0,0 +1,54 @@
+#include "mixeremulator.h"
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+
+/*
+ * osccb-emulator — mixer falso em localhost para testar o OSCCB sem console
+ *
+ *   osccb-emulator                          # 32 canais, meters a 20 Hz, 127.0.0.1:10024
+ *   osccb-emulator --channels 8 --meter-hz 50
+ *   osccb-emulator --bind 0.0.0.0 --channels 1024 --meter-hz 200   # estresse
+ *
+ * No app: aba Logs, IP 127.0.0.1, porta 10024, Conectar.
+ */
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("osccb-emulator");
+
+    QCommandLineParser cli;
+    cli.setApplicationDescription("Emulador X-Air/X32 (OSC/UDP) para testes de carga do OSCCB");
+    cli.addHelpOption();
+
+    const QCommandLineOption optBind    ("bind",      "Endereço local (padrão 127.0.0.1).", "ip", "127.0.0.1");
+    const QCommandLineOption optPort    ("port",      "Porta UDP (padrão 10024).", "porta", "10024");
+    const QCommandLineOption optChannels("channels",  "Canais expostos e no /meters/1 (1..4096, padrão 32).", "n", "32");
+    const QCommandLineOption optHz      ("meter-hz",  "Frames de meter por segundo (1..1000, padrão 20).", "hz", "20");
+    const QCommandLineOption optModel   ("model",     "Modelo informado no /xinfo (padrão XR18).", "modelo", "XR18");
+    const QCommandLineOption optName    ("name",      "Nome do console (padrão osccb-emu).", "nome", "osccb-emu");
+    const QCommandLineOption optEchoSelf("echo-self", "Ecoa os sets também para o cliente que enviou.");
+    const QCommandLineOption optStats   ("stats",     "Relatório a cada N s (0 = desliga, padrão 5).", "s", "5");
+    cli.addOptions({ optBind, optPort, optChannels, optHz, optModel, optName, optEchoSelf, optStats });
+    cli.process(app);
+
+    MixerEmulator::Options opt;
+    opt.bind      = QHostAddress(cli.value(optBind));
+    opt.port      = quint16(cli.value(optPort).toUInt());
+    opt.channels  = cli.value(optChannels).toInt();
+    opt.meterHz   = cli.value(optHz).toInt();
+    opt.model     = cli.value(optModel);
+    opt.name      = cli.value(optName);
+    opt.echoSelf  = cli.isSet(optEchoSelf);
+    opt.statsSecs = cli.value(optStats).toInt();
+
+    if (opt.bind.isNull()) {
+        qCritical("endereço inválido em --bind");
+        return 2;
+    }
+
+    MixerEmulator emu(opt);
+    if (!emu.start()) return 1;
+    return app.exec();
+}
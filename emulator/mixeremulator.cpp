@@ -0,0 +1,400 @@
+#include "mixeremulator.h"
+#include <QtEndian>
+#include <QDebug>
+#include <QStringList>
+#include <QtMath>
+#include <cmath>
+#include <cstring>
+
+// ====== Codec OSC mínimo (mesmas regras do OscClient) ======
+static void appendPadded(QByteArray& out, const QByteArray& s)
+{
+    out += s;
+    out += '\0';
+    while (out.size() % 4) out += '\0';
+}
+
+static void appendBE32(QByteArray& out, quint32 v)
+{
+    const quint32 be = qToBigEndian(v);
+    out.append(reinterpret_cast<const char*>(&be), 4);
+}
+
+static QByteArray encodeMessage(const QString& address, const QVariantList& args)
+{
+    QByteArray tags(",");
+    QByteArray body;
+    for (const QVariant& v : args) {
+        switch (v.typeId()) {
+        case QMetaType::Int:
+        case QMetaType::Bool:
+            tags += 'i'; appendBE32(body, quint32(qint32(v.toInt())));
+            break;
+        case QMetaType::Float:
+        case QMetaType::Double: {
+            tags += 'f';
+            const float f = v.toFloat(); quint32 bits; std::memcpy(&bits, &f, 4);
+            appendBE32(body, bits);
+            break;
+        }
+        case QMetaType::QByteArray: {
+            tags += 'b';
+            const QByteArray b = v.toByteArray();
+            appendBE32(body, quint32(b.size()));
+            body += b;
+            while (body.size() % 4) body += '\0';
+            break;
+        }
+        default:
+            tags += 's'; appendPadded(body, v.toString().toUtf8());
+            break;
+        }
+    }
+    QByteArray pkt;
+    appendPadded(pkt, address.toUtf8());
+    appendPadded(pkt, tags);
+    return pkt + body;
+}
+
+static QString readPadded(const QByteArray& buf, int& i)
+{
+    const int start = i;
+    while (i < buf.size() && buf[i] != '\0') ++i;
+    const QString s = QString::fromUtf8(buf.constData() + start, i - start);
+    if (i < buf.size()) ++i;
+    while (i % 4 && i < buf.size()) ++i;
+    return s;
+}
+
+static bool readBE32(const QByteArray& buf, int& i, quint32& v)
+{
+    if (i + 4 > buf.size()) return false;
+    std::memcpy(&v, buf.constData() + i, 4);
+    v = qFromBigEndian(v);
+    i += 4;
+    return true;
+}
+
+static bool decodeMessage(const QByteArray& d, QString& address, QVariantList& args)
+{
+    int i = 0;
+    address = readPadded(d, i);
+    if (!address.startsWith('/')) return false;
+    const QString tags = readPadded(d, i);
+    for (int k = 1; k < tags.size(); ++k) {
+        quint32 u = 0;
+        switch (tags[k].toLatin1()) {
+        case 'i': if (!readBE32(d, i, u)) return false; args << int(qint32(u)); break;
+        case 'f': { if (!readBE32(d, i, u)) return false; float f; std::memcpy(&f, &u, 4); args << f; break; }
+        case 's': args << readPadded(d, i); break;
+        case 'b': {
+            if (!readBE32(d, i, u) || i + int(u) > d.size()) return false;
+            args << d.mid(i, int(u)); i += int(u);
+            while (i % 4 && i < d.size()) ++i;
+            break;
+        }
+        default: break;
+        }
+    }
+    return true;
+}
+
+// X32: fader 0..1 -> dB (lei de 4 segmentos)
+static QString faderToDbText(float f)
+{
+    if (f <= 0.0f) return QStringLiteral("-oo");
+    double db;
+    if      (f >= 0.5f)    db = f * 40.0  - 30.0;
+    else if (f >= 0.25f)   db = f * 80.0  - 50.0;
+    else if (f >= 0.0625f) db = f * 160.0 - 70.0;
+    else                   db = f * 480.0 - 90.0;
+    return QString::asprintf("%+.1f", db);
+}
+
+static QString peerKey(const QHostAddress& a, quint16 p) { return a.toString() + ':' + QString::number(p); }
+static QString twoDigits(int n) { return QString("%1").arg(n, 2, 10, QChar('0')); }
+
+// ====== Emulador ======
+MixerEmulator::MixerEmulator(const Options& opt, QObject* parent)
+    : QObject(parent), m_opt(opt)
+{
+    m_opt.channels = qBound(1, m_opt.channels, 4096);
+    m_opt.meterHz  = qBound(1, m_opt.meterHz, 1000);
+
+    connect(&m_sock, &QUdpSocket::readyRead, this, &MixerEmulator::onReadyRead);
+
+    m_meterTimer.setTimerType(Qt::PreciseTimer);
+    m_meterTimer.setInterval(1000 / m_opt.meterHz);
+    connect(&m_meterTimer, &QTimer::timeout, this, &MixerEmulator::onMeterTick);
+
+    connect(&m_statsTimer, &QTimer::timeout, this, &MixerEmulator::printStats);
+
+    initParams();
+}
+
+void MixerEmulator::initParams()
+{
+    for (int ch = 1; ch <= m_opt.channels; ++ch) {
+        const QString base = "/ch/" + twoDigits(ch);
+        m_params.insert(base + "/mix/fader", 0.75f);
+        m_params.insert(base + "/mix/on", 1);
+        m_params.insert(base + "/config/name", QString("Ch %1").arg(twoDigits(ch)));
+    }
+    m_params.insert("/lr/mix/fader", 0.75f);
+    m_params.insert("/lr/mix/on", 1);
+    m_params.insert("/-prefs/name", m_opt.name);
+
+    m_params.insert("/-snap/name", QString());
+    for (int n = 1; n <= 64; ++n) m_params.insert("/-snap/" + twoDigits(n) + "/name", QString());
+}
+
+bool MixerEmulator::start()
+{
+    if (!m_sock.bind(m_opt.bind, m_opt.port)) {
+        qCritical().noquote() << "bind falhou em" << m_opt.bind.toString() << m_opt.port << ":" << m_sock.errorString();
+        return false;
+    }
+    m_clock.start();
+    m_meterTimer.start();
+    if (m_opt.statsSecs > 0) m_statsTimer.start(m_opt.statsSecs * 1000);
+
+    qInfo().noquote() << QString("Emulador %1 (%2) em %3:%4 — %5 canais, meters a %6 Hz")
+                             .arg(m_opt.model, m_opt.name, m_opt.bind.toString())
+                             .arg(m_opt.port).arg(m_opt.channels).arg(m_opt.meterHz);
+    return true;
+}
+
+void MixerEmulator::onReadyRead()
+{
+    while (m_sock.hasPendingDatagrams()) {
+        QByteArray d;
+        d.resize(int(m_sock.pendingDatagramSize()));
+        QHostAddress from; quint16 port = 0;
+        if (m_sock.readDatagram(d.data(), d.size(), &from, &port) < 0) continue;
+        ++m_rxPackets;
+
+        Peer& p = m_peers[peerKey(from, port)];
+        p.addr = from;
+        p.port = port;
+        p.lastSeenMs = m_clock.elapsed();   // qualquer tráfego renova as assinaturas
+
+        handlePacket(d, p);
+    }
+}
+
+void MixerEmulator::handlePacket(const QByteArray& d, Peer& from)
+{
+    if (d.startsWith(QByteArray("#bundle\0", 8))) {
+        int i = 16;
+        quint32 len = 0;
+        while (readBE32(d, i, len) && i + int(len) <= d.size()) {
+            handlePacket(d.mid(i, int(len)), from);
+            i += int(len);
+        }
+        return;
+    }
+
+    QString address; QVariantList args;
+    if (decodeMessage(d, address, args))
+        handleMessage(address, args, from);
+}
+
+void MixerEmulator::handleMessage(const QString& address, const QVariantList& args, Peer& from)
+{
+    if (address == QLatin1String("/xremote")) { from.xremote = true; return; }
+
+    if (address == QLatin1String("/xinfo")) {
+        reply(from, address, { m_opt.bind.toString(), m_opt.name, m_opt.model, m_opt.firmware });
+        return;
+    }
+
+    if (address == QLatin1String("/status")) {
+        reply(from, address, { QStringLiteral("active"), m_opt.bind.toString(), m_opt.name });
+        return;
+    }
+
+    if (address == QLatin1String("/meters")) {
+        const QString which = args.value(0).toString();
+        if (which == QLatin1String("/meters/1")) from.meters1 = true;
+        if (which == QLatin1String(isX32() ? "/meters/2" : "/meters/3")) from.meters3 = true;
+        return;
+    }
+
+    if (address == QLatin1String("/node")) {
+        reply(from, address, { nodeText(args.value(0).toString()) });
+        return;
+    }
+
+    if (address == QLatin1String("/-snap/save") || address == QLatin1String("/-snap/load")) {
+        const int slot = args.value(0).toInt();
+        if (slot < 1 || slot > 64) return;
+        if (address.endsWith(QLatin1String("save"))) saveSnapshot(slot);
+        else                                          loadSnapshot(slot);
+        return;
+    }
+
+    // GET: sem argumento ou ",s ?" (forma usada pelo OscClient)
+    const bool isGet = args.isEmpty() ||
+                       (args.size() == 1 && args.first().typeId() == QMetaType::QString
+                        && args.first().toString() == QLatin1String("?"));
+    if (isGet) {
+        const auto it = m_params.constFind(address);
+        if (it != m_params.constEnd()) reply(from, address, { it.value() });
+        return;
+    }
+
+    // SET: guarda e ecoa
+    QVariant v = args.first();
+    if (v.typeId() == QMetaType::Double) v = v.toFloat();
+    m_params.insert(address, v);
+    echo(from, address, v);
+}
+
+void MixerEmulator::saveSnapshot(int slot)
+{
+    QHash<QString, QVariant>& snap = m_snapshots[slot];
+    snap.clear();
+    for (auto it = m_params.constBegin(); it != m_params.constEnd(); ++it)
+        if (it.key().startsWith(QLatin1String("/ch/")) || it.key().startsWith(QLatin1String("/lr/")))
+            snap.insert(it.key(), it.value());
+
+    const QString nameKey = "/-snap/" + twoDigits(slot) + "/name";
+    m_params.insert(nameKey, m_params.value("/-snap/name"));
+    qInfo().noquote() << "snapshot" << slot << "salvo:" << snap.size() << "parâmetros";
+}
+
+void MixerEmulator::loadSnapshot(int slot)
+{
+    const auto snap = m_snapshots.constFind(slot);
+    if (snap == m_snapshots.constEnd()) return;
+
+    // como o console: quem está em /xremote (inclusive quem pediu) recebe o que mudou
+    const Peer everyone;
+    int changed = 0;
+    for (auto it = snap->constBegin(); it != snap->constEnd(); ++it) {
+        if (m_params.value(it.key()) == it.value()) continue;
+        m_params.insert(it.key(), it.value());
+        echo(everyone, it.key(), it.value());
+        ++changed;
+    }
+    qInfo().noquote() << "snapshot" << slot << "carregado:" << changed << "parâmetros mudaram";
+}
+
+QString MixerEmulator::nodeText(const QString& path) const
+{
+    const QString base = path.startsWith('/') ? path : '/' + path;
+    const QString prefix = base + '/';
+
+    QStringList keys;
+    for (auto it = m_params.constBegin(); it != m_params.constEnd(); ++it)
+        if (it.key().startsWith(prefix)) keys << it.key();
+    keys.sort();
+
+    QString line = base;
+    for (const QString& k : std::as_const(keys)) {
+        const QVariant& v = m_params.value(k);
+        if (k.endsWith(QLatin1String("/on")))         line += v.toInt() ? " ON" : " OFF";
+        else if (k.endsWith(QLatin1String("/fader"))) line += ' ' + faderToDbText(v.toFloat());
+        else if (v.typeId() == QMetaType::QString)    line += " \"" + v.toString() + '"';
+        else                                          line += ' ' + v.toString();
+    }
+    return line + '\n';
+}
+
+// ====== Envio ======
+void MixerEmulator::sendRaw(const Peer& to, const QByteArray& pkt)
+{
+    if (m_sock.writeDatagram(pkt, to.addr, to.port) == pkt.size()) {
+        ++m_txPackets;
+        m_txBytes += quint64(pkt.size());
+    }
+}
+
+void MixerEmulator::reply(const Peer& to, const QString& address, const QVariantList& args)
+{
+    sendRaw(to, encodeMessage(address, args));
+}
+
+void MixerEmulator::echo(const Peer& from, const QString& address, const QVariant& value)
+{
+    const qint64 now = m_clock.elapsed();
+    const QByteArray pkt = encodeMessage(address, { value });
+    for (const Peer& p : std::as_const(m_peers)) {
+        if (!p.xremote || now - p.lastSeenMs > kSubscriptionMs) continue;
+        if (!m_opt.echoSelf && p.addr == from.addr && p.port == from.port) continue;
+        sendRaw(p, pkt);
+    }
+}
+
+// ====== Meters ======
+// Sinal sintético: cada canal oscila entre -60 e -6 dB com fase/frequência próprias
+bool MixerEmulator::isX32() const
+{
+    return m_opt.model.startsWith(QLatin1String("X32")) || m_opt.model.startsWith(QLatin1String("M32"));
+}
+
+QByteArray MixerEmulator::meterBlob(int values, double t, int seed) const
+{
+    const bool x32 = isX32();
+    QByteArray blob;
+    blob.reserve(4 + values * (x32 ? 4 : 2));
+    if (x32) {
+        const qint32 le = qToLittleEndian(qint32(values));
+        blob.append(reinterpret_cast<const char*>(&le), 4);
+    } else {
+        appendBE32(blob, quint32(values * 2));
+    }
+    for (int k = 0; k < values; ++k) {
+        const double phase = (k + 1) * 0.37 + seed;
+        const double freq  = 0.4 + (k % 7) * 0.15;
+        double db = -33.0 + 27.0 * std::sin(t * freq * 2.0 * M_PI + phase);
+        if (seed == 3) { // LR pós-fader
+            if (!m_params.value("/lr/mix/on").toInt()) db = -90.0;
+            else db += (m_params.value("/lr/mix/fader").toFloat() - 0.75f) * 40.0;
+        }
+        if (x32) {
+            const float lin = float(std::pow(10.0, db / 20.0));
+            quint32 bits; std::memcpy(&bits, &lin, 4);
+            const quint32 le = qToLittleEndian(bits);
+            blob.append(reinterpret_cast<const char*>(&le), 4);
+            continue;
+        }
+        const qint16 s = qint16(qBound(-32767.0, db * 256.0, 32767.0));
+        const quint16 be = qToBigEndian(quint16(s));
+        blob.append(reinterpret_cast<const char*>(&be), 2);
+    }
+    return blob;
+}
+
+void MixerEmulator::onMeterTick()
+{
+    const qint64 now = m_clock.elapsed();
+    const double t = now / 1000.0;
+
+    QByteArray pkt1, pkt3;   // montados só se houver assinante
+    for (auto it = m_peers.begin(); it != m_peers.end(); ) {
+        Peer& p = it.value();
+        if (now - p.lastSeenMs > kSubscriptionMs) { it = m_peers.erase(it); continue; }
+
+        if (p.meters1) {
+            if (pkt1.isEmpty()) pkt1 = encodeMessage("/meters/1", { meterBlob(m_opt.channels * 3, t, 1) });
+            sendRaw(p, pkt1);
+            ++m_meterFrames;
+        }
+        if (p.meters3) {
+            // X32: /meters/2 = bus 16, matrix 6, L, R, ... (49 valores)
+            if (pkt3.isEmpty()) pkt3 = isX32() ? encodeMessage("/meters/2", { meterBlob(49, t, 3) })
+                                               : encodeMessage("/meters/3", { meterBlob(6, t, 3) });
+            sendRaw(p, pkt3);
+            ++m_meterFrames;
+        }
+        ++it;
+    }
+}
+
+void MixerEmulator::printStats()
+{
+    qInfo().noquote() << QString("clientes %1 | rx %2 pacotes | tx %3 pacotes, %4 kB | frames de meter %5")
+                             .arg(m_peers.size()).arg(m_rxPackets).arg(m_txPackets)
+                             .arg(m_txBytes / 1024).arg(m_meterFrames);
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include <QObject>
+#include <QUdpSocket>
+#include <QHostAddress>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QVariant>
+#include <QVariantList>
+
+/*
+ * MixerEmulator — mixer X-Air/X32 falso para testes sem hardware
+ * - Responde /xinfo, /-prefs/name, /node e GET de qualquer parâmetro
+ *   (sem argumento ou com ",s ?", como o OscClient manda)
+ * - Guarda os parâmetros (/ch/NN/mix/fader|on, /ch/NN/config/name,
+ *   /lr/mix/*, e o que mais chegar) e ecoa cada set para os clientes em /xremote
+ * - /meters "/meters/1" e "/meters/3" ("/meters/2" no X32/M32): transmite blobs
+ *   sintéticos na taxa e quantidade de canais configuradas (até níveis de estresse)
+ * - /-snap/save|load ,i N: guarda/restaura /ch/* e /lr/* (eco de tudo que mudar);
+ *   nomes em /-snap/NN/name (o de /-snap/name vai para o slot salvo)
+ * - Assinaturas expiram em kSubscriptionMs sem tráfego do cliente
+ *   (qualquer datagrama do cliente renova, como o keep-alive do app)
+ *
+ * Formato dos blobs = o do modelo informado: X-Air = u32 BE (tamanho em
+ * bytes) seguido de int16 BE em dB*256; X32/M32 = int32 LE (nº de valores)
+ * seguido de floats LE lineares (1.0 = 0 dBFS), LR no /meters/2.
+ */
+
+class MixerEmulator : public QObject
+{
+    Q_OBJECT
+public:
+    struct Options {
+        QHostAddress bind      = QHostAddress::LocalHost;
+        quint16      port      = 10024;
+        int          channels  = 32;     // canais expostos (/ch/01..NN) e no /meters/1
+        int          meterHz   = 20;     // frames de meter por segundo, por assinatura
+        bool         echoSelf  = false;  // ecoar o set também para quem mandou
+        QString      model     = QStringLiteral("XR18");
+        QString      name      = QStringLiteral("osccb-emu");
+        QString      firmware  = QStringLiteral("1.17");
+        int          statsSecs = 5;      // 0 = sem relatório periódico
+    };
+
+    explicit MixerEmulator(const Options& opt, QObject* parent = nullptr);
+
+    bool start();
+
+private slots:
+    void onReadyRead();
+    void onMeterTick();
+    void printStats();
+
+private:
+    static constexpr int kSubscriptionMs = 10000;
+
+    struct Peer {
+        QHostAddress addr;
+        quint16      port = 0;
+        qint64       lastSeenMs = 0;
+        bool         xremote = false;
+        bool         meters1 = false;
+        bool         meters3 = false;   // banco do LR (/meters/3 ou /meters/2)
+    };
+
+    Options      m_opt;
+    QUdpSocket   m_sock;
+    QTimer       m_meterTimer;
+    QTimer       m_statsTimer;
+    QElapsedTimer m_clock;
+
+    QHash<QString, QVariant> m_params;   // endereço -> valor (int/float/string)
+    QHash<QString, Peer>     m_peers;    // "ip:porta" -> cliente
+    QHash<int, QHash<QString, QVariant>> m_snapshots;   // /-snap/save: slot -> /ch e /lr
+
+    quint64 m_rxPackets = 0, m_txPackets = 0, m_txBytes = 0, m_meterFrames = 0;
+
+    void initParams();
+    void handleMessage(const QString& address, const QVariantList& args, Peer& from);
+    void saveSnapshot(int slot);
+    void loadSnapshot(int slot);
+    void handlePacket(const QByteArray& d, Peer& from);
+
+    void reply(const Peer& to, const QString& address, const QVariantList& args);
+    void echo(const Peer& from, const QString& address, const QVariant& value);
+    void sendRaw(const Peer& to, const QByteArray& pkt);
+
+    QByteArray meterBlob(int values, double t, int seed) const;
+    bool isX32() const;
+    QString    nodeText(const QString& path) const;
+};
@@ -0,0 +1,100 @@
+#include "logbuffer.h"
+#include <QDateTime>
+#include <QByteArray>
+#include <cstring>
+#include <thread>
+
+LogBuffer& LogBuffer::instance()
+{
+    static LogBuffer s_instance;
+    return s_instance;
+}
+
+const char* LogBuffer::levelName(Level level)
+{
+    switch (level) {
+    case Debug:   return "DEBUG";
+    case Info:    return "INFO";
+    case Notice:  return "NOTICE";
+    case Warning: return "WARN";
+    case Error:   return "ERROR";
+    }
+    return "?";
+}
+
+// Copia no máximo cap-1 bytes sem cortar um caractere UTF-8 no meio
+static void copyUtf8(char* dst, int cap, const char* src, int len)
+{
+    if (len > cap - 1) {
+        len = cap - 1;
+        while (len > 0 && (quint8(src[len]) & 0xC0) == 0x80) --len; // recua p/ início do caractere
+    }
+    std::memcpy(dst, src, size_t(len));
+    dst[len] = '\0';
+}
+
+// ============ Escrita (qualquer thread) ============
+void LogBuffer::write(Level level, const char* source, const QString& msg)
+{
+    const QByteArray utf8 = msg.toUtf8();
+    const qint64 now = QDateTime::currentMSecsSinceEpoch();
+
+    const quint64 seq = m_next.fetch_add(1, std::memory_order_relaxed);
+    Slot& s = m_slots[seq & (kCapacity - 1)];
+
+    // dois escritores a kCapacity de distância caem no mesmo slot: o carimbo
+    // ímpar é tomado por CAS; quem chega com ticket mais velho desiste
+    quint64 cur = s.stamp.load(std::memory_order_relaxed);
+    for (;;) {
+        if (cur >= 2 * seq + 1) return;    // uma volta posterior já passou: esta entrada é a perdida
+        if (cur & 1) {                     // volta anterior ainda copiando (cópia curta)
+            std::this_thread::yield();
+            cur = s.stamp.load(std::memory_order_relaxed);
+            continue;
+        }
+        if (s.stamp.compare_exchange_weak(cur, 2 * seq + 1, std::memory_order_relaxed))
+            break;
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    s.e.seq   = seq;
+    s.e.msecs = now;
+    s.e.level = level;
+    copyUtf8(s.e.source, kSourceLen, source ? source : "", source ? int(std::strlen(source)) : 0);
+    copyUtf8(s.e.text, kTextLen, utf8.constData(), utf8.size());
+
+    s.stamp.store(2 * seq + 2, std::memory_order_release);
+}
+
+// ============ Leitura (thread da UI) ============
+quint64 LogBuffer::read(quint64 from, QVector<Entry>& out, int maxCount, quint64* dropped) const
+{
+    quint64 lost = 0;
+    const quint64 end = m_next.load(std::memory_order_acquire);
+
+    if (end > from + kCapacity) {          // o anel já deu a volta sobre o que não lemos
+        lost += end - kCapacity - from;
+        from = end - kCapacity;
+    }
+
+    quint64 t = from;
+    for (; t < end && maxCount > 0; ++t) {
+        const Slot& s = m_slots[t & (kCapacity - 1)];
+        const quint64 ready = 2 * t + 2;
+
+        const quint64 s1 = s.stamp.load(std::memory_order_acquire);
+        if (s1 < ready) break;             // escritor ainda copiando: retoma daqui na próxima
+        if (s1 > ready) { ++lost; continue; } // já sobrescrito por uma volta posterior
+
+        Entry copy;
+        std::memcpy(&copy, &s.e, sizeof(Entry));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (s.stamp.load(std::memory_order_relaxed) != s1) { ++lost; continue; }
+
+        out.append(copy);
+        --maxCount;
+    }
+
+    if (dropped) *dropped = lost;
+    return t;
+}
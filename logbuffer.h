@@ -0,0 +1,71 @@
+#pragma once
+#include <QtGlobal>
+#include <QString>
+#include <QVector>
+#include <atomic>
+
+/*
+ * LogBuffer — anel fixo de logs, lock-free, multi-produtor / um consumidor
+ * - Qualquer thread escreve (write): 1 fetch_add + cópia para um slot fixo,
+ *   sem lock, sem alocação no anel (texto truncado em UTF-8)
+ * - Cada slot tem um carimbo (seqlock): o escritor o toma por CAS (dois
+ *   escritores no mesmo slot não misturam a entrada) e o leitor descarta o
+ *   que foi sobrescrito no meio da cópia em vez de bloquear o escritor
+ * - Capacidade fixa: numa rajada, as entradas mais antigas são perdidas
+ *   (o leitor sabe quantas via read())
+ * - Leitura só pela thread da UI (LogModel, export)
+ */
+
+class LogBuffer
+{
+public:
+    enum Level : quint8 { Debug = 0, Info, Notice, Warning, Error };
+
+    static constexpr int kCapacity  = 4096;  // potência de 2
+    static constexpr int kSourceLen = 16;
+    static constexpr int kTextLen   = 224;
+
+    struct Entry {
+        quint64 seq;                 // nº sequencial global (ticket)
+        qint64  msecs;               // epoch em ms
+        Level   level;
+        char    source[kSourceLen];  // UTF-8, terminado em '\0'
+        char    text[kTextLen];      // UTF-8, terminado em '\0'
+
+        QString sourceString() const { return QString::fromUtf8(source); }
+        QString textString()   const { return QString::fromUtf8(text); }
+    };
+
+    static LogBuffer& instance();
+
+    void write(Level level, const char* source, const QString& msg);
+
+    // Copia até maxCount entradas a partir do ticket `from` para `out`.
+    // Devolve o ticket de onde continuar; *dropped = entradas sobrescritas antes de lidas.
+    quint64 read(quint64 from, QVector<Entry>& out, int maxCount, quint64* dropped = nullptr) const;
+
+    quint64 head() const { return m_next.load(std::memory_order_acquire); }
+
+    static const char* levelName(Level level);
+
+private:
+    LogBuffer() = default;
+    Q_DISABLE_COPY(LogBuffer)
+
+    struct Slot {
+        std::atomic<quint64> stamp{0};   // 2*seq+1 = escrevendo; 2*seq+2 = pronto
+        Entry e;
+    };
+
+    static_assert((kCapacity & (kCapacity - 1)) == 0, "kCapacity deve ser potência de 2");
+
+    std::atomic<quint64> m_next{0};
+    Slot m_slots[kCapacity];
+};
+
+// atalhos (qualquer thread)
+inline void logDebug  (const char* src, const QString& m) { LogBuffer::instance().write(LogBuffer::Debug,   src, m); }
+inline void logInfo   (const char* src, const QString& m) { LogBuffer::instance().write(LogBuffer::Info,    src, m); }
+inline void logNotice (const char* src, const QString& m) { LogBuffer::instance().write(LogBuffer::Notice,  src, m); }
+inline void logWarning(const char* src, const QString& m) { LogBuffer::instance().write(LogBuffer::Warning, src, m); }
+inline void logError  (const char* src, const QString& m) { LogBuffer::instance().write(LogBuffer::Error,   src, m); }
@@ -0,0 +1,135 @@
+#include "logmodel.h"
+#include <QColor>
+#include <QDateTime>
+#include <QIODevice>
+#include <QTextStream>
+#include <cstring>
+
+LogModel::LogModel(QObject* parent)
+    : QAbstractListModel(parent)
+{
+    m_fontBold.setBold(true);
+    m_fontItalic.setItalic(true);
+
+    m_scratch.reserve(kBatch);
+
+    m_refresh.setInterval(250);
+    connect(&m_refresh, &QTimer::timeout, this, &LogModel::pull);
+    m_refresh.start();
+
+    pull(); // o que já estava no anel antes do modelo existir
+}
+
+int LogModel::rowCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : int(m_rows.size());
+}
+
+static QColor levelColor(LogBuffer::Level level)
+{
+    switch (level) {
+    case LogBuffer::Debug:   return QColor("gray");
+    case LogBuffer::Info:    return QColor("cyan");
+    case LogBuffer::Notice:  return QColor("lime");
+    case LogBuffer::Warning: return QColor("yellow");
+    case LogBuffer::Error:   return QColor("red");
+    }
+    return QColor("white");
+}
+
+QVariant LogModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || index.row() >= int(m_rows.size())) return {};
+    const LogBuffer::Entry& e = m_rows[size_t(index.row())];
+
+    switch (role) {
+    case Qt::DisplayRole:
+        return QDateTime::fromMSecsSinceEpoch(e.msecs).toString("hh:mm:ss.zzz")
+               + QLatin1String("  ") + e.textString();
+    case Qt::ToolTipRole:
+        return QString("%1 [%2]").arg(QLatin1String(LogBuffer::levelName(e.level)), e.sourceString());
+    case Qt::ForegroundRole:
+        return levelColor(e.level);
+    case Qt::FontRole:
+        if (e.level >= LogBuffer::Notice) return m_fontBold;
+        if (e.level <= LogBuffer::Info)   return m_fontItalic;
+        return {};
+    default:
+        return {};
+    }
+}
+
+void LogModel::setMaxRows(int rows)
+{
+    m_maxRows = qMax(1, rows);
+    trim();
+}
+
+// ============ Refresh limitado: 1 lote por tick ============
+void LogModel::pull()
+{
+    if (LogBuffer::instance().head() == m_next && m_dropped == 0) return;
+
+    m_scratch.clear();
+    quint64 lost = 0;
+    m_next = LogBuffer::instance().read(m_next, m_scratch, kBatch, &lost);
+    m_dropped += lost;
+
+    if (m_dropped) {
+        // aviso sintético no lugar do que o anel descartou
+        LogBuffer::Entry note{};
+        note.msecs = QDateTime::currentMSecsSinceEpoch();
+        note.level = LogBuffer::Warning;
+        std::strcpy(note.source, "log");
+        const QByteArray t = QString("%1 linha(s) de log descartada(s)").arg(m_dropped).toUtf8();
+        std::strncpy(note.text, t.constData(), LogBuffer::kTextLen - 1);
+        m_scratch.prepend(note);
+        m_dropped = 0;
+    }
+
+    if (m_scratch.isEmpty()) return;
+
+    const int first = int(m_rows.size());
+    beginInsertRows(QModelIndex(), first, first + int(m_scratch.size()) - 1);
+    m_rows.insert(m_rows.end(), m_scratch.cbegin(), m_scratch.cend());
+    endInsertRows();
+
+    trim();
+}
+
+void LogModel::trim()
+{
+    const int excess = int(m_rows.size()) - m_maxRows;
+    if (excess <= 0) return;
+
+    beginRemoveRows(QModelIndex(), 0, excess - 1);
+    m_rows.erase(m_rows.begin(), m_rows.begin() + excess);
+    endRemoveRows();
+}
+
+// ============ Export sob demanda ============
+bool LogModel::exportText(QIODevice* dev) const
+{
+    if (!dev || !dev->isWritable()) return false;
+
+    // o anel inteiro (kCapacity), não só as m_maxRows linhas da lista
+    const LogBuffer& log = LogBuffer::instance();
+    const quint64 end = log.head();
+    quint64 t = end > quint64(LogBuffer::kCapacity) ? end - LogBuffer::kCapacity : 0;
+    QVector<LogBuffer::Entry> all;
+    all.reserve(int(end - t));
+    while (t < end) {
+        const quint64 n = log.read(t, all, kBatch);
+        if (n == t) break;                 // escritor copiando: o resto é mais novo que o pedido
+        t = n;
+    }
+
+    QTextStream out(dev);
+    for (const LogBuffer::Entry& e : all) {
+        out << QDateTime::fromMSecsSinceEpoch(e.msecs).toString("yyyy-MM-dd hh:mm:ss.zzz") << ' '
+            << LogBuffer::levelName(e.level) << " [" << e.sourceString() << "] "
+            << e.textString() << '\n';
+    }
+    out.flush();
+    return out.status() == QTextStream::Ok;
+}
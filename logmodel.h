@@ -0,0 +1,50 @@
+#pragma once
+#include <QAbstractListModel>
+#include <QTimer>
+#include <QVector>
+#include <QFont>
+#include <deque>
+#include "logbuffer.h"
+
+class QIODevice;
+
+/*
+ * LogModel — visão do LogBuffer para um QListView (virtualizado)
+ * - Puxa do anel num timer (refresh limitado): rajada de logs = 1 insert por tick
+ * - Guarda no máximo maxRows linhas; as mais antigas saem pelo topo
+ * - Cor/fonte por nível (ForegroundRole/FontRole), texto montado só em data()
+ * - exportText(): despejo em texto puro do anel inteiro, sob demanda
+ */
+
+class LogModel : public QAbstractListModel
+{
+    Q_OBJECT
+public:
+    explicit LogModel(QObject* parent = nullptr);
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+    void setMaxRows(int rows);
+    void setRefreshInterval(int ms) { m_refresh.setInterval(ms); }
+
+    // "yyyy-MM-dd hh:mm:ss.zzz NIVEL [origem] mensagem", uma por linha
+    bool exportText(QIODevice* dev) const;
+
+public slots:
+    void pull();
+
+private:
+    static constexpr int kBatch = 1024; // máximo lido do anel por tick
+
+    std::deque<LogBuffer::Entry> m_rows;   // front = mais antiga
+    QVector<LogBuffer::Entry> m_scratch;
+    quint64 m_next    = 0;   // próximo ticket a ler do anel
+    quint64 m_dropped = 0;   // perdidas desde o último aviso
+    int     m_maxRows = 2000;
+    QTimer  m_refresh;
+    QFont   m_fontBold;
+    QFont   m_fontItalic;
+
+    void trim();
+};
@@ -1,28 +1,66 @@
 #include "mainwindow.h"
+#include "osccbstyle.h"
+#include "trace.h"
+#include "oscclient.h"
+#include "stateexport.h"
 
 #include <QApplication>
+#include <QCommandLineParser>
+#include <QTimer>
+#include <QStandardPaths>
+#include <QDir>
 
 int main(int argc, char *argv[])
 {
     QApplication a(argc, argv);
-    QApplication::setStyle("Fusion");
 
+    // Captura/replay de tráfego OSC (perfil/regressão com carga determinística)
+    QCommandLineParser cli;
+    const QCommandLineOption optRecord("record", "Grava RX/TX OSC em <arquivo> (.osccap).", "arquivo");
+    const QCommandLineOption optReplay("replay", "Reproduz a captura <arquivo> no RX.", "arquivo");
+    const QCommandLineOption optFast  ("replay-fast", "Replay na velocidade máxima (sem respeitar os tempos).");
+    const QCommandLineOption optQuit  ("quit-after-replay", "Fecha o app ao fim do replay.");
+    // Proxy: outros tablets apontam para este host e dividem a sessão com o console
+    const QCommandLineOption optProxy ("proxy", "Serve outras instâncias na <porta> UDP (padrão 10024).", "porta", "10024");
+    // Estado/meters para processos locais (overlay, monitor): layout em osccb_shm.h
+    const QCommandLineOption optShm   ("export-shm", "Publica fader/mute/meters em memória compartilhada.");
+    cli.addOptions({ optRecord, optReplay, optFast, optQuit, optProxy, optShm });
+    cli.parse(QCoreApplication::arguments()); // parse(): argumento estranho (Android/launcher) não derruba o app
 
-    QPalette p;
-    p.setColor(QPalette::Window,        QColor("#1f2125"));
-    p.setColor(QPalette::Base,          QColor("#2a2d34"));
-    p.setColor(QPalette::AlternateBase, QColor("#23262b"));
-    p.setColor(QPalette::Button,        QColor("#2f333a"));
-    p.setColor(QPalette::Text,          QColor("#e9eef3"));
-    p.setColor(QPalette::ButtonText,    QColor("#e9eef3"));
-    p.setColor(QPalette::BrightText,    QColor("#ffffff"));
-    p.setColor(QPalette::Highlight,     QColor("#3aaed8"));
-    p.setColor(QPalette::HighlightedText, QColor("#0b0d10"));
-    QApplication::setPalette(p);
+    // Trace opt-in desde a partida (OSCCB_TRACE=1); despejado ao sair
+    const bool traceAtStartup = qEnvironmentVariableIntValue("OSCCB_TRACE") != 0;
+    if (traceAtStartup) Trace::setEnabled(true);
+
+    // Tema único (estilo + paleta) — substitui os styleSheet por widget do .ui
+    auto* style = new OsccbStyle;
+    QApplication::setStyle(style);
+    QApplication::setPalette(style->standardPalette());
 
 
     MainWindow w;
     //w.show();
     w.showFullScreen();
-    return a.exec();
+
+    OscClient* osc = w.oscClient();
+    if (cli.isSet(optRecord)) osc->startRecording(cli.value(optRecord));
+    if (cli.isSet(optProxy))  w.setProxyEnabled(true, quint16(cli.value(optProxy).toUInt()));
+    StateExport shm;
+    if (cli.isSet(optShm))    shm.start(osc);
+    if (cli.isSet(optReplay)) {
+        if (cli.isSet(optQuit))
+            QObject::connect(osc, &OscClient::replayFinished, &a, &QApplication::quit, Qt::QueuedConnection);
+        const auto mode = cli.isSet(optFast) ? OscClient::ReplayMode::AsFastAsPossible
+                                             : OscClient::ReplayMode::RealTime;
+        const QString path = cli.value(optReplay);
+        QTimer::singleShot(0, osc, [osc, path, mode] { osc->startReplay(path, mode); });
+    }
+
+    const int rc = a.exec();
+
+    if (traceAtStartup && Trace::enabled()) {
+        const QString dir = QStandardPaths::writableLocation(QStandardPaths::DocumentsLocation);
+        QDir().mkpath(dir);
+        Trace::writeChromeJson(dir + "/osccb-trace-exit.json");
+    }
+    return rc;
 }
@@ -1,6 +1,18 @@
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
+#include "ui_helptab.h"
+#include "ui_logstab.h"
 #include "oscclient.h"
+#include "logmodel.h"
+#include "metrics.h"
+#include "statspanel.h"
+#include "trace.h"
+#include "meterdecode.h"
+#include "scenestore.h"
+#include "scenemorph.h"
+#include "showfile.h"
+#include "oscproxy.h"
+#include "mixersessions.h"
 
 #include <algorithm>   // std::clamp
 #include <cmath>       // std::lround
@@ -9,7 +21,15 @@
 #include <QTimer>
 #include <climits>
 #include <cstring>     // std::memset
-#include <QSettings>
+#include <QFile>
+#include <QDateTime>
+#include <QScrollBar>
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QSpinBox>
+#include <QComboBox>
+#include <QGridLayout>
+#include <QFileDialog>
 
 #ifdef Q_OS_ANDROID
 #include <QJniObject>
@@ -24,9 +44,22 @@ static int g_nextPctLR[2] = {0,0};
 static QTimer* g_uiMeterTimer = nullptr;
 // ================================================================================
 
-// ======= CACHE p/ evitar reenvio redundante de mute por canal =======
-static int s_lastMuteSent[NUMBER_OF_CHANNELS]; // -1=desconhecido, 0/1 = on enviado (1=unmuted)
+// ======= Ícones de mute (pré-rasterizados/compartilhados no ModernButton) =======
+static const QString kIconMuted   = QStringLiteral(":/icons/resources/muted.svg");
+static const QString kIconUnmuted = QStringLiteral(":/icons/resources/unmuted.svg");
+// ===================================================================
+
+// ======= CACHE p/ evitar reenvio redundante de mute/fader por canal =======
+static int   s_lastMuteSent[NUMBER_OF_CHANNELS];  // -1=desconhecido, 0/1 = on enviado (1=unmuted)
+static float s_lastSentFader[NUMBER_OF_CHANNELS]; // < 0 = nada enviado
+static float s_lastSentLR = -1.0f;
 static bool s_lastMuteInit = false;
+
+// vale para um console só: zerado na partida e na troca de console
+static void resetSendCache() {
+    for (int i = 0; i < NUMBER_OF_CHANNELS; ++i) { s_lastMuteSent[i] = -1; s_lastSentFader[i] = -1.0f; }
+    s_lastSentLR = -1.0f;
+}
 // ===================================================================
 
 #ifdef Q_OS_ANDROID
@@ -47,7 +80,9 @@ MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
     , ui(new Ui::MainWindow)
 {
+    startupTimer.start();
     ui->setupUi(this);
+    startupSetupUiMs = startupTimer.elapsed();
 
     // //REF:COMBOBOX
     // QStringList comboItens = {"Inicio","Canais","Meter de Sinais","Meter de Volume","Volume Rotativo","Volume Incremental","Botão de Mute","Criar e Modificar Perfil","Rótulos de canais"};
@@ -76,9 +111,9 @@ MainWindow::MainWindow(QWidget *parent)
 
     // ui->comboBoxHelp->setPopupMaxHeight(280);
 
-    // inicializa cache de mute enviado
+    // inicializa cache de mute/fader enviado
     if (!s_lastMuteInit) {
-        for (int i=0;i<NUMBER_OF_CHANNELS;++i) s_lastMuteSent[i] = -1;
+        resetSendCache();
         s_lastMuteInit = true;
     }
 
@@ -96,8 +131,29 @@ MainWindow::MainWindow(QWidget *parent)
             [](Qt::ApplicationState st){ if (st == Qt::ApplicationActive) keepScreenOn(true); });
 #endif
 
-    // ====== OscClient como MEMBRO ======
-    osc = new OscClient(this);
+    // ====== Cenas / labels: profiles.ini lido uma vez, gravado em segundo plano ======
+    scenes = new SceneStore(profilesIniPath(), this);
+    morph  = new SceneMorph(this);
+    connect(morph, &SceneMorph::frame,    this, &MainWindow::onMorphFrame);
+    connect(morph, &SceneMorph::finished, this, &MainWindow::onMorphFinished);
+    // interrompida (dial, troca de console, outra cena): os mutes da cena saem mesmo assim
+    connect(morph, &SceneMorph::cancelled, this, &MainWindow::onMorphFinished);
+    // Android pode matar o processo em segundo plano: grava o que estiver pendente
+    connect(qApp, &QGuiApplication::applicationStateChanged, this,
+            [this](Qt::ApplicationState st){ if (st == Qt::ApplicationSuspended) scenes->flush(); });
+
+    // ====== Sessões OSC: um socket e um tick para todos os consoles ======
+    // osc = cliente da sessão ativa (a UI fala com ele); a 0 é a da descoberta
+    sessions = new MixerSessions(this);
+    addConsole(tr("Principal"), QHostAddress(), 10024);
+    const QStringList consoles = scenes->value("CONFIG", "consoles").toStringList();
+    for (const QString& spec : consoles) addConsole(spec);
+    osc = sessions->active();
+    // taxa de envio dos faders acompanha a latência medida do mixer (sessão ativa)
+    connect(sessions, &MixerSessions::latencyChanged, this, &MainWindow::onLatencyChanged);
+    connect(osc, &OscClient::replayFinished, this, [this](quint64 n, qint64 ms) {
+        appendLog(QString("Replay: %1 datagramas em %2 ms").arg(n).arg(ms), LogBuffer::Notice);
+    });
     // osc->setTarget(QHostAddress("192.168.1.43"), 10024);
 
     //REF:DIAL ====== Liga arrays de widgets ======
@@ -149,11 +205,6 @@ MainWindow::MainWindow(QWidget *parent)
     pbTauArray[0] = ui->pb_TAU_0; pbTauArray[1] = ui->pb_TAU_1; pbTauArray[2] = ui->pb_TAU_2;
     pbTauArray[3] = ui->pb_TAU_3; pbTauArray[4] = ui->pb_TAU_4; pbTauArray[5] = ui->pb_TAU_5;
 
-    //REF:HELP
-    helpButtons[0] = ui->pbHelp_01; helpButtons[1] = ui->pbHelp_02; helpButtons[2] = ui->pbHelp_03; helpButtons[3] = ui->pbHelp_04;
-    helpButtons[4] = ui->pbHelp_05; helpButtons[5] = ui->pbHelp_06; helpButtons[6] = ui->pbHelp_07; helpButtons[7] = ui->pbHelp_08;
-    helpButtons[8] = ui->pbHelp_09;
-
     ui->pb_TAU_0->setProperty("sceneKey", "INICIO");
     ui->pb_TAU_1->setProperty("sceneKey", "ORACAO");
     ui->pb_TAU_2->setProperty("sceneKey", "RECITATIVO");
@@ -161,129 +212,13 @@ MainWindow::MainWindow(QWidget *parent)
     ui->pb_TAU_4->setProperty("sceneKey", "PALAVRA");
     ui->pb_TAU_5->setProperty("sceneKey", "ENCERRAMENTO");
 
-    this->helpGroup = new QButtonGroup(this);
-    this->helpGroup->setExclusive(true);
-
-    for (uint8_t i=0; i< NUMBER_OF_HELPS;i++){
-        this->helpGroup->addButton(this->helpButtons[i]);
-    }
-
-    //VAZIO NA ENTRADA helpTexts[0]
-    QString textos;
-    textos = " ";
-    helpTexts.append(textos);
-
-    //AO ABRIR O OSCCB helpTexts[1]
-    textos = "<h1>Ao abrir o programa OSCCB</h1>";
-    textos = textos + "<p>Ao abrir o programa, será feita uma tentativa automática de comunicação com o mixer na rede.";
-    textos = textos + " Se a comunicação falhar, será feita uma tentativa de conexão automática utilizando o endereço e porta que aparecem em <b>logs</b>.";
-    textos = textos + " Se ainda assim falhar, você tem a opção de:";
-    textos = textos + "<p>1. Tentar a conexão apertando o botão <b>Conectar</b>.";
-    textos = textos + "<p>2. Trocar endereço e/ou porta antes de tentar conectar (necessário conhecimento da infraestrutura).";
-    textos = textos + "<p><p><H3>Operação do Som</h3>";
-    textos = textos + "<p>Em operação normal, tudo que será necessário fazer é <b>controlar os níveis de volume</b> e os <b>mutes</b> dos canais, na aba <b>Faders</b>.";
-    textos = textos + "<p><p><h3>Logs</h3>";
-    textos = textos + "<p>A aba logs <b>somente será usada em caso de anomalias. Ela contém informação sistemica do aplicativo e pode indicar a razão de uma eventual falha.";
-    textos = textos + " Caso algo ocorra, uma foto dessa tela pode ser enviada ao suporte de som para análise.";
-    textos = textos + "<p><p><h3>Config</h3>";
-    textos = textos + "<p>Reservado à engenharia";
-    textos = textos + "<p><p><h3>Ajuda</h3>";
-    textos = textos + "<p>No menu de ajuda os Operadores de Som encontrarão todas as informações necessárias de operação.";
-    helpTexts.append(textos);
-
-    //CANAIS helpTexts[2]
-    textos = "<h1>Controlador de Canais</h1><p>Cada canal tem um conjunto de componentes, como abaixo. Repare que cada canal é composto por um <b>rótulo</b>, o <b>nome do canal</b>, ";
-    textos =  textos + "um <b>medidor de volume</b> (percentual, de 0% até 100%), um <b>valor fracionado</b> que vai de 0.000 até 1.000 (sendo esse um valor de comunicação com o mixer), ";
-    textos = textos + "dois <b>botões (- e +)</b> para volume de 1% em 1% para mais ou para menos, um <b>volume rotativo</b> para ajustes precisos e um botão de mudo.";
-    helpTexts.append(textos);
-
-    //MEDIDOR DE SINAL helpTexts[3]
-    textos = "<h1>Medidor de Sinal dos microfones</h1>";
-    textos = textos + "<p>A barra vertical mostra a entrada de sinal, que varia conforme o volume. Mas não é importante para o operador";
-    textos = textos + " saber o valor que representa. O importante é notar se há sinal, indicando que o microfone está funcionando.";
-    textos = textos + "<p>Abaixo está a barra de sinal em destaque, <b>do lado direito do controlador de canal</b>. O medidor de sinal é a <b>barra vertical do lado direito</b>";
-    helpTexts.append(textos);
-
-    //MEDIDOR DE VOLUME helpText[4]
-    textos = "<h1>Medidor de Volume configurado</h1>";
-    textos = textos + "<p>A barra horizontal abaixo do texto do canal representa o percentual de volume ajustado através do volume rotativo, ";
-    textos = textos + "do botão de volume ou advindo do mixer. O <b>valor percentual real</b> está dentro do <b>disco de volume rotativo</b>.";
-    helpTexts.append(textos);
-
-    //VOLUME ROTATIVO helpText[5]
-    textos = "<h1>Volume Rotativo</h1>";
-    textos = textos + "<p>Nos programas tradicionais, o ajuste de volume é feito através dos faders lineares. O problema com esse tipo de ajuste em";
-    textos = textos + " tablets é a imprecisão no ajuste, gerando saltos significativos de volume. Com o disco de volume rotativo a precisão é muito maior.";
-    textos = textos + "No disco de volume você pode notar um pequeno circulo. Ele é indicador de posição. Para ajustar o volume, <b>toque no disco, não no circulo</b>.";
-    textos = textos + "<p>Você deve tocar no disco do lado oposto do circulo para ajuste sem salto.";
-    textos = textos + "<p>Toque no volume rotativo abaixo (lado direito) E gire o volume 1 volta completa. Cada volta representa 10% do volume máximo.";
-    textos = textos + " Para experimentar maior precisão, toque no disco de volume e arraste o dedo para longe. Quanto mais longe do disco de volume, ";
-    textos = textos + " maior será a precisão ao efetuar o ajuste.";
-    helpTexts.append(textos);
-
-    //VOLUME INCREMENTAL helpText[6]
-    textos = "<h1>Volume por incremento/decremento</h1>";
-    textos = textos + "<p>Os botões <b>+</b> e <b>-</b> fazem o ajuste de volume incrementando ou decrementando em 1% a cada toque. Em muitos casos ";
-    textos = textos + "pode ser mais adequado (e mais rápido) ajustar o volume através desse botões. Sinta-se à vontade para usar seu modo preferido!";
-    helpTexts.append(textos);
-
-    //MUDO helpText[7]
-    textos = "<h1>Botões de mute/unmute</h1>";
-    textos = textos + "<p>Quando os microfones estão abertos, o botão de mute fica verde, com o desenho de um microfone. Quando algum microfone é ";
-    textos = textos + " colocado em <b>mudo</b>, o botão fica vermelho, com um desenho de microfone cortado.";
-    textos = textos + "<p>Dependendo do momento, determinados microfones precisam estar fechados. Para reduzir esse trabalho, veja o menu de ajuda <b>CRIAR E MODIFICAR PERFIL</b>.";
-    textos = textos + "Abaixo, é possível testar o botão para observar sua mudança (no controlador à direita).";
-    helpTexts.append(textos);
-
-    //CRIAR E MODIFICAR PERFIL helpText[8]
-    textos = "<h1>Criar e Modificar perfil</h1>";
-    textos = textos + "<p>Repare no topo da tela os botões:";
-    textos = textos + "<p><b>INICIO ORAÇÃO RECITATIVO TESTEMUNHO PALAVRA ENCERRAMENTO</b>";
-    textos = textos + "<p>Durante o culto de louvor e adoração a Deus, temos esses diferentes momentos. Em cada momento, uma combinação diferente de microfones fica aberto ou fechado.";
-    textos = textos + "<p>Para auxiliar o operador de som na comunhão durante o culto direcionando menos atenção à operação dos microfones, foi criado o perfil do momento.";
-    textos = textos + "<p>Inicialmente não há uma configuração. Então deve-se tocar no botão <b>INICIO</b>, tocar nos microfones para que fiquem como desejado (por exemplo, no início apenas ";
-    textos = textos + "o microfone do púlpito é utilizado, os demais microfones podem ficar mudos), então toca-se em <b>GRAVAR ESTADOS DOS MICROFONES</b>.";
-    textos = textos + " Feito isso, podemos então tocar no botão <b>ORAÇÃO</b>, onde o púlpito normalmente é fechado e o microfone de oração é aberto por padrão. Ao fazer essa configuração, clicamos em ";
-    textos = textos + "<b>GRAVAR ESTADOS DOS MICS<b>. Isso fará a gravação dos estados dos microfones no perfil atual. Assim, já teremos gravado dois perfís: <b>INICIO</b> e <b>ORAÇÃO</b>.";
-    textos = textos + " Faça isso em cada um dos perfis. Na próxima vez que um dos botões do topo forem tocados, a combinação dos microfones será automática!";
-    textos = textos + "<p><p><H3>E se quiser modificar o perfil?</h3>";
-    textos = textos + "<p>Se quiser modificar o perfil, basta ajustar a nova combinação e tocar novamente em <b>GRAVAR ESTADOS DOS MICS</b>.";
-    textos = textos + "<p>Cada vez que um novo estado for gravado, a próxima vez que o botão do topo for acessado, a configuração já será a nova.";
-    textos = textos + "<p><p><h3>E se quiser remover os perfís?</h3>";
-    textos = textos + "<p>Se quiser voltar ao padrão de instalação, basta abrir todos os microfones e gravar cada perfil com todos os microfones abertos.";
-    textos = textos + "<p><p><h3>E se precisar usar algum microfone que esteja fechado?</h3>";
-    textos = textos + "<p>Se um determinado microfone estiver gravado no perfil como <b>fechado</b>, basta tira o <b>mute</b>. Se for ocasional, não precisa gravar o perfil. ";
-    textos = textos + "A próxima vez que o perfil for acessado, automaticamente voltará a estar mudo.";
-    helpTexts.append(textos);
-
-    //RÓTULOS
-    textos = "<h1>Rótulos dos Canais</h1>";
-    textos = textos + "<p>Em cada controlador de canal há um título que rotula o canal. Se desejar nomear de forma diferente, toque sobre o título e escreva o novo nome e aperte <b>OK</b>. Se tiver saido do teclado, basta tocar em algum botão ";
-    textos = textos + "como <b>mute</b> ou <b>+</b> seguido de <b>-</b>, ou se for nomear outro controlador de canal, toque no próximo rótulo. Experimente fazê-lo no <b>RÓTULO DO CONTROLADOR</b> abaixo.";
-    helpTexts.append(textos);
-
-    textos.clear();
-
-    connect(ui->btRotuloHELP, SIGNAL(clicked(bool)), this, SLOT(changeTitle()));
-
-    for (int i = 0; i < NUMBER_OF_HELPS; ++i) {
-        helpButtons[i]->setProperty("pageIndex", i);
-        connect(helpButtons[i], &QPushButton::clicked,this, &MainWindow::onHelpButtonsClicked);
-    }
-
     //REF:HELP:HIDE REF:HIDES
     //ui->frame_CH->hide();
     ui->tabWidget->setCurrentIndex(0);
 
 
-    //MUTE DO EXEMPLO DO HELP
-    ui->pbMuteHELP->setCheckedColor("#00C853");
-    ui->pbMuteHELP->setNormalColor("red");
-    ui->pbMuteHELP->setHoverColor("red");
-    ui->pbMuteHELP->setPressedColor("red");
-    ui->pbMuteHELP->setIcon(QIcon(":/icons/resources/muted.svg"));
-    connect(ui->pbMuteHELP,SIGNAL(clicked(bool)),this,SLOT(pbMuteHelpSlot()));
-    //connect(helpButtons[0],SIGNAL(clicked(bool)),this,SLOT(onHelpButtonsClicked()));
+    // Abas Logs/Ajuda são montadas na 1ª vez que forem abertas (ver setupLogsTab/setupHelpTab)
+    connect(ui->tabWidget, &QTabWidget::currentChanged, this, &MainWindow::onTabActivated);
 
     sceneGroup = new QButtonGroup(this);
     sceneGroup->setExclusive(true);
@@ -309,25 +244,6 @@ MainWindow::MainWindow(QWidget *parent)
     connect(ui->dial_LR, &QDial::sliderPressed,  this, &MainWindow::onLRDialPressed);
     connect(ui->dial_LR, &QDial::sliderReleased, this, &MainWindow::onLRDialReleased);
 
-    //DIAL HELP
-    ui->dial_HELP->setWrapping(true);
-    ui->dial_HELP->setNotchesVisible(false);
-    ui->dial_HELP->setRange(0, 999);       // 1 volta = 1000 passos
-    ui->dial_HELP->setSingleStep(1);
-    ui->dial_HELP->setPageStep(10);
-
-    ui->dial_HELP->setProperty("turns", 10);            // visual: 10 voltas
-    ui->dial_HELP->setProperty("fullCircle", true);
-    ui->dial_HELP->setProperty("displayTurnPercent", false); // texto = % total
-    ui->dial_HELP->setProperty("showValue", true);
-
-    // Aparência
-    ui->dial_HELP->setProperty("trackColor",    QColor("#e6e6e6"));
-    ui->dial_HELP->setProperty("progressColor", QColor("#00C853"));
-    ui->dial_HELP->setProperty("handleColor",   QColor("#ffffff"));
-    ui->dial_HELP->setProperty("textColor",     QColor("white"));
-    ui->dial_HELP->setProperty("thickness",     6);
-
     // ----- Setup inicial do dial LR (ACUMULADOR: 10 voltas obrigatórias) -----
     ui->dial_LR->setWrapping(true);
     ui->dial_LR->setNotchesVisible(false);
@@ -340,12 +256,7 @@ MainWindow::MainWindow(QWidget *parent)
     ui->dial_LR->setProperty("displayTurnPercent", false); // texto = % total
     ui->dial_LR->setProperty("showValue", true);
 
-    // Aparência
-    ui->dial_LR->setProperty("trackColor",    QColor("#e6e6e6"));
-    ui->dial_LR->setProperty("progressColor", QColor("#00C853"));
-    ui->dial_LR->setProperty("handleColor",   QColor("#ffffff"));
-    ui->dial_LR->setProperty("textColor",     QColor("white"));
-    ui->dial_LR->setProperty("thickness",     6);
+    // Aparência: cores/espessura vêm do OsccbStyle (polish)
 
     lastDialLR     = ui->dial_LR->value(); // 0..999
     accumLR        = 0;                    // 0..10000 (10 voltas = 100%)
@@ -354,13 +265,13 @@ MainWindow::MainWindow(QWidget *parent)
     // Timer único (~30 Hz) para envio do LR
     sendTimerLR = new QTimer(this);
     sendTimerLR->setSingleShot(true);
-    sendTimerLR->setInterval(33);
+    sendTimerLR->setInterval(kSendIntervalMinMs);
     sendTimerLR->setTimerType(Qt::PreciseTimer);
     connect(sendTimerLR, &QTimer::timeout, this, &MainWindow::flushLRFaderSend);
 
     // Estado visual inicial do LR
     if (ui->labelPercent_LR){
-        ui->labelPercent_LR->setText(QString::number(currentFaderLR, 'f', 4));
+        ui->labelPercent_LR->setValue(currentFaderLR);
     }
     if (ui->pbarVol_LR){
         ui->pbarVol_LR->setValue(int(std::lround(currentFaderLR * 100.0f)));
@@ -394,25 +305,21 @@ MainWindow::MainWindow(QWidget *parent)
 
         if (dials[i]) {
             // progresso total 0..1 para o arco verde
-            dials[i]->setProperty("progress01", currentFaderArr[i]);
+            dials[i]->setProgress01(currentFaderArr[i]);
 
             // (opcional) mesmo visual do LR
             dials[i]->setProperty("turns", 10);
             dials[i]->setProperty("fullCircle", true);
             dials[i]->setProperty("displayTurnPercent", false); // texto = % total (se showValue=true)
             dials[i]->setProperty("showValue", true);          // normalmente os canais não mostram texto
-            dials[i]->setProperty("trackColor",    QColor("#e6e6e6"));
-            dials[i]->setProperty("progressColor", QColor("#00C853"));
-            dials[i]->setProperty("handleColor",   QColor("#ffffff"));
-            dials[i]->setProperty("textColor",     QColor("white"));
-            dials[i]->setProperty("thickness",     6);
+            // cores/espessura: OsccbStyle (polish)
         }
 
 
         // throttle por canal (~30 Hz)
         sendTimers[i] = new QTimer(this);
         sendTimers[i]->setSingleShot(true);
-        sendTimers[i]->setInterval(33);
+        sendTimers[i]->setInterval(kSendIntervalMinMs);
         sendTimers[i]->setTimerType(Qt::PreciseTimer); // timing estável
         connect(sendTimers[i], &QTimer::timeout, this, [this, i](){ flushFaderSend(i); });
 
@@ -422,27 +329,28 @@ MainWindow::MainWindow(QWidget *parent)
     //REF:OSC
     // ====== Bind UDP e descoberta ======
     QTimer::singleShot(0, this, [this]() {
-        if (!osc->open(LOCAL_PORT_BIND)) { //ATENCAO: ISSO É PORTA LOCAL, DO APP
-            appendLog("Falha ao abrir UDP local. Não operativo.", "red", true, false);
+        if (!sessions->open(LOCAL_PORT_BIND)) { //ATENCAO: ISSO É PORTA LOCAL, DO APP
+            appendLog("Falha ao abrir UDP local. Não operativo.", LogBuffer::Error);
             return;
         }
 
         QTimer::singleShot(0, this, [this]() {
-            const bool found = osc->setTargetFromDiscovery("192.168.1.0/24", 3500);
+            OscClient* primary = sessions->client(0);
+            const bool found = primary->setTargetFromDiscovery("192.168.1.0/24", 3500);
             if (!found) {
-                appendLog("Mixer não encontrado via scan. Tentando IP de entrada...", "yellow", true, false);
-                osc->setTarget(QHostAddress(ui->lineEditIP->text()), 10024);
+                appendLog("Mixer não encontrado via scan. Tentando IP de entrada...", LogBuffer::Warning);
+                // IP/porta da aba Logs (gravados no INI ou o padrão do .ui); sem porta vale a do perfil
+                setupLogsTab();
+                const QStringList hp = logsUi->lineEditIP->text().trimmed().split(':');
+                quint16 port = quint16(hp.value(1).toUInt());
+                if (!port) port = quint16(logsUi->lineEditPort->text().toUInt());
+                primary->setTarget(QHostAddress(hp.value(0)), port ? port : primary->caps().port);
             } else {
-                qDebug() << "Mixer em" << osc->targetAddress() << osc->targetPort();
-                appendLog("Mixer em " + osc->targetAddress().toString().toUtf8(), "cyan", false, true);
+                qDebug() << "Mixer em" << primary->targetAddress() << primary->targetPort();
+                appendLog("Mixer em " + primary->targetAddress().toString(), LogBuffer::Info);
             }
-            osc->queryName();
-
-            osc->startFeedbackKeepAlive(5000);
-            osc->subscribeMetersAllChannels();
-            osc->subscribeMetersLR();
-            osc->syncAll(NUMBER_OF_CHANNELS);   // GET inicial (fader+mute) dos canais
-
+            // demais consoles têm IP fixo (aba Config): só abrem a sessão
+            for (int i = 0; i < sessions->count(); ++i) startSession(sessions->client(i));
         });
     });
 
@@ -452,6 +360,16 @@ MainWindow::MainWindow(QWidget *parent)
         g_uiMeterTimer->setInterval(30);
         g_uiMeterTimer->setTimerType(Qt::CoarseTimer);
         connect(g_uiMeterTimer, &QTimer::timeout, this, [this](){
+            TRACE_SCOPE("ui.meterTick");
+
+            // atraso do tick em relação ao intervalo (métrica)
+            static QElapsedTimer s_lastTick;
+            if (s_lastTick.isValid()) {
+                const qint64 lateUs = s_lastTick.nsecsElapsed() / 1000 - qint64(g_uiMeterTimer->interval()) * 1000;
+                Metrics::record(Metrics::TimerLateUs, quint32(qMax<qint64>(0, lateUs)));
+            }
+            s_lastTick.start();
+
             // canais 0..7
             auto meterBarAt = [this](int ch)->QProgressBar*{
                 switch (ch) {
@@ -487,10 +405,18 @@ MainWindow::MainWindow(QWidget *parent)
     }
     // ========================================================================
 
+    // ====== Estado recebido: aplicado na UI 1x por frame ======
+    pendingRx.clear();
+    rxApplyTimer.setSingleShot(true);
+    rxApplyTimer.setInterval(16);                 // ~60 Hz
+    rxApplyTimer.setTimerType(Qt::PreciseTimer);
+    connect(&rxApplyTimer, &QTimer::timeout, this, &MainWindow::applyPendingRx);
+
     // ====== Handler de RX (alimenta UI) ======
-    connect(osc, &OscClient::oscMessageReceived, this,
+    connect(sessions, &MixerSessions::oscMessageReceived, this,
             [this](const QString& addr, const QVariantList& args)
             {
+                TRACE_SCOPE("ui.rx");
                 if (addr == QLatin1String("/xremote")) return;
 
                 // ================================
@@ -503,8 +429,11 @@ MainWindow::MainWindow(QWidget *parent)
                     const QString model  = sl.value(1, "?");
                     const QString fw     = sl.value(2, "?");
                     const QString proto  = sl.value(3, "?");
-                    appendLog(QString("Mixer identificado: %1 %2 — FW %3 — %4").arg(brand, model, fw, proto),
-                              "lime", true, false);
+                    const MixerCaps& c   = osc->caps();     // perfil já trocado pelo OscClient
+                    appendLog(QString("Mixer identificado: %1 %2 — FW %3 — %4 — perfil %5: %6 canais, %7 buses, %8 DCAs")
+                                  .arg(brand, model, fw, proto, QLatin1String(c.name))
+                                  .arg(c.channels).arg(c.buses).arg(c.dcas),
+                              LogBuffer::Notice);
                     return;
                 }
 
@@ -515,48 +444,9 @@ MainWindow::MainWindow(QWidget *parent)
                     const QVariant &v0 = args.first();
                     if (!v0.canConvert<QByteArray>()) return;
 
-                    const QByteArray raw = v0.toByteArray();
-                    if (raw.isEmpty()) return;
-
-                    int offset = 0;
-                    if (raw.size() >= 6) {
-                        quint32 beLen;
-                        std::memcpy(&beLen, raw.constData(), 4);
-                        const quint32 declared = qFromBigEndian(beLen);
-                        const int remaining = raw.size() - 4;
-                        if (declared > 0 && declared <= (quint32)remaining && int(declared) == remaining) {
-                            offset = 4;
-                        }
-                    }
-
-                    const int bytes   = raw.size() - offset;
-                    const int nShorts = bytes / 2;
-                    if (nShorts <= 0) return;
-
-                    auto rdI16 = [&](int idx)->qint16{
-                        if (idx < 0 || idx >= nShorts) return INT16_MIN;
-                        quint16 be; std::memcpy(&be, raw.constData() + offset + idx*2, 2);
-                        return (qint16)qFromBigEndian(be);
-                    };
-
-                    const float FLOOR_DB = -70.0f;
-                    auto dbTo01 = [&](float dB)->float{
-                        if (dB <= FLOOR_DB) return 0.0f;
-                        if (dB >= 0.0f)     return 1.0f;
-                        return (dB - FLOOR_DB) / (0.0f - FLOOR_DB);
-                    };
-
-                    // SEM drop de frames; apenas preenche cache
-                    for (int ch = 0; ch < NUMBER_OF_CHANNELS; ++ch) {
-                        const qint16 s = rdI16(ch);
-                        float lin01 = 0.0f;
-                        if (s != INT16_MIN) {
-                            const float dB = s / 256.0f;
-                            lin01 = dbTo01(dB);
-                        }
-                        const int pct = int(std::lround(lin01 * 100.0f));
-                        g_nextPctCh[ch] = pct; // cache; UI aplica no timer
-                    }
+                    // SEM drop de frames; apenas preenche cache (UI aplica no timer)
+                    // tamanho já validado pelo OscClient com o perfil do modelo
+                    osc->profile().channelMeters(v0.toByteArray(), g_nextPctCh, kNumUiCh);
                     return;
                 }
 
@@ -567,111 +457,29 @@ MainWindow::MainWindow(QWidget *parent)
                     const QVariant &v0 = args.first();
                     if (!v0.canConvert<QByteArray>()) return;
 
-                    const QByteArray raw = v0.toByteArray();
-                    if (raw.isEmpty()) return;
-
-                    int offset = 0;
-                    if (raw.size() >= 6) {
-                        quint32 beLen;
-                        std::memcpy(&beLen, raw.constData(), 4);
-                        const quint32 declared = qFromBigEndian(beLen);
-                        const int remaining = raw.size() - 4;
-                        if (declared > 0 && declared <= (quint32)remaining && int(declared) == remaining) {
-                            offset = 4;
-                        }
-                    }
-
-                    const int nShorts = (raw.size() - offset) / 2;
-                    if (nShorts < 2) return;
-
-                    auto rdI16 = [&](int idx)->qint16{
-                        if (idx < 0 || idx >= nShorts) return INT16_MIN;
-                        quint16 be; std::memcpy(&be, raw.constData() + offset + idx*2, 2);
-                        return (qint16)qFromBigEndian(be);
-                    };
-
-                    const float FLOOR_DB = -70.0f;
-                    auto dbTo01 = [&](float dB)->float{
-                        if (dB <= FLOOR_DB) return 0.0f;
-                        if (dB >= 0.0f)     return 1.0f;
-                        return (dB - FLOOR_DB) / (0.0f - FLOOR_DB);
-                    };
-
-                    const qint16 sL = rdI16(0);
-                    const qint16 sR = rdI16(1);
-
-                    auto s16ToPct = [&](qint16 s)->int{
-                        if (s == INT16_MIN) return 0;
-                        const float dB = s / 256.0f;
-                        const float lin01 = dbTo01(dB);
-                        return int(std::lround(lin01 * 100.0f));
-                    };
-
-                    g_nextPctLR[0] = s16ToPct(sL);
-                    g_nextPctLR[1] = s16ToPct(sR);
+                    osc->profile().lrMeters(v0.toByteArray(), g_nextPctLR);
                     return;
                 }
 
                 // ==========================================================
-                //REF:LR LR on/off (/lr/mix/on) -> pushButton_LR (ícone + check)
+                // Estado (fader/mute de canais e LR): só grava no buffer pendente.
+                // A UI é aplicada 1x por frame em applyPendingRx() (último valor vence).
                 // ==========================================================
+                //REF:LR LR on/off (/lr/mix/on) -> pushButton_LR
                 if (addr == QLatin1String("/lr/mix/on") && !args.isEmpty()) {
-                    const int on = args.first().toInt();
-                    const bool checked = (on != 0);
-                    if (ui->pushButton_LR) {
-                        if (ui->pushButton_LR->isChecked() != checked) {
-                            QSignalBlocker block2(ui->pushButton_LR);
-                            ui->pushButton_LR->setChecked(checked);
-                        }
-
-
-                        ui->pushButton_LR->setIcon(QIcon(checked
-                                                             ? QStringLiteral(":/icons/resources/unmuted.svg")
-                                                             : QStringLiteral(":/icons/resources/muted.svg")));
-                    }
-
+                    pendingRx.muteLR = args.first().toInt() != 0 ? 1 : 0;
+                    schedulePendingRx();
                     return;
                 }
 
-                // ==========================================================
                 // Fader LR (0..1) -> acumulador + dial_LR (0..999), label e pbar
-                // ==========================================================
                 if (addr == QLatin1String("/lr/mix/fader") && !args.isEmpty()) {
-                    const float v01 = std::clamp(args.first().toFloat(), 0.0f, 1.0f);
-
-                    currentFaderLR = v01;
-                    ui->dial_LR->setProperty("progress01", currentFaderLR);
-                    accumLR        = int(v01 * 10000.0f + 0.5f);
-
-                    // Se estiver arrastando, só atualiza label/barra
-                    if (draggingLR) {
-                        if (ui->labelPercent_LR)
-                            ui->labelPercent_LR->setText(QString::number(currentFaderLR, 'f', 4));
-                        if (ui->pbarVol_LR)
-                            ui->pbarVol_LR->setValue(int(std::lround(v01 * 100.0f)));
-                        return;
-                    }
-
-                    // move o dial (0..999) sem emitir signals
-                    {
-                        const int steps = accumLR % 1000;
-                        QSignalBlocker block(ui->dial_LR);
-                        ui->dial_LR->setValue(steps);
-                        lastDialLR = steps;
-                    }
-
-                    // >>> REFLETE NA UI DO LR <<<
-                    if (ui->labelPercent_LR)
-                        ui->labelPercent_LR->setText(QString::number(v01, 'f', 4));
-                    if (ui->pbarVol_LR)
-                        ui->pbarVol_LR->setValue(int(std::lround(v01 * 100.0f)));
-
+                    pendingRx.faderLR = std::clamp(args.first().toFloat(), 0.0f, 1.0f);
+                    schedulePendingRx();
                     return;
                 }
 
-                // ==========================================================
                 // Demais paths de canal (/ch/NN/...)
-                // ==========================================================
                 if (!addr.startsWith(QLatin1String("/ch/")) || args.isEmpty()) return;
 
                 bool ok = false;
@@ -682,55 +490,15 @@ MainWindow::MainWindow(QWidget *parent)
 
                 // Fader (float 0..1) -> pbarVol_X e dials
                 if (addr.endsWith(QLatin1String("/mix/fader"))) {
-                    if (dragging[idx]) {
-                        // Atualiza só o cache enquanto arrasta (não move o dial)
-                        currentFaderArr[idx] = std::clamp(args.first().toFloat(), 0.0f, 1.0f);
-
-                        // ↙↙ NOVO: mantém o arco verde proporcional durante o arrasto
-                        if (dials[idx]) dials[idx]->setProperty("progress01", currentFaderArr[idx]);
-
-                        // (opcional) se quiser atualizar label/barra durante o arrasto:
-                        // labelsPercentArray[idx]->setText(QString::number(currentFaderArr[idx], 'f', 4));
-                        // if (percBarsArray[idx]) percBarsArray[idx]->setValue(int(std::lround(currentFaderArr[idx]*100.0f)));
-                        return;
-                    }
-
-                    float v01 = std::clamp(args.first().toFloat(), 0.0f, 1.0f);
-                    currentFaderArr[idx] = v01;
-                    accumArr[idx]        = int(v01 * 10000.0f + 0.5f);
-
-                    if (dials[idx]) dials[idx]->setProperty("progress01", currentFaderArr[idx]);
-
-                    if (dials[idx]) {
-                        const int steps = accumArr[idx] % 1000;
-                        QSignalBlocker block(dials[idx]);
-                        dials[idx]->setValue(steps);
-                        lastDialArr[idx] = steps;
-                    }
-
-                    labelsPercentArray[idx]->setText(QString::number(v01, 'f', 4));
-                    if (percBarsArray[idx]) percBarsArray[idx]->setValue(int(std::lround(v01 * 100.0f)));
+                    pendingRx.fader[idx] = std::clamp(args.first().toFloat(), 0.0f, 1.0f);
+                    schedulePendingRx();
                     return;
                 }
 
-                // Mute (int/bool) — ATUALIZA UI SEM EMITIR SINAL
+                // Mute (int/bool): 1 => unmuted (ligado), 0 => muted (desligado)
                 if (addr.endsWith(QLatin1String("/mix/on"))) {
-                    const int onInt = args.first().toInt(); // 1 => unmuted (ligado), 0 => muted (desligado)
-                    const bool shouldChecked = (onInt == 0) ? true : false; // nosso botão checked = muted
-
-                    if (buttons[idx]) {
-                        // só toca no botão se realmente mudou
-                        if (buttons[idx]->isChecked() != shouldChecked) {
-                            QSignalBlocker block(buttons[idx]); // evita idToggled -> onMuteToggled -> loop
-                            buttons[idx]->setChecked(shouldChecked);
-                        }
-                        // ÍCONE **NÃO** é alterado aqui (fica sob controle dos handlers de UI)
-                    }
-                    //REF:LR
-                    // if (ui->pushButton_LR->isChecked() != shouldChecked){
-                    //     QSignalBlocker blockLR(ui->pushButton_LR);
-                    //     ui->pushButton_LR->setChecked(shouldChecked);
-                    // }
+                    pendingRx.mute[idx] = args.first().toInt() != 0 ? 1 : 0;
+                    schedulePendingRx();
                     return;
                 }
             });
@@ -806,14 +574,14 @@ MainWindow::MainWindow(QWidget *parent)
     ui->pushButton_LR->setCheckedColor(QColor("#00C853"));
     ui->pushButton_LR->setTextColor(Qt::white);
     ui->pushButton_LR->setRadius(12);
-    ui->pushButton_LR->setIcon(QIcon(":/icons/resources/unmuted.svg"));
+    ui->pushButton_LR->setStateIcons(kIconMuted, kIconUnmuted); // LR: checked = aberto
     //ui->pushButton_LR->setText("LR");
     ui->pushButton_LR->setMinimumSize(35,35);
     ui->pushButton_LR->setMaximumSize(35,35);
 
 
     for (uint8_t i = 0; i < NUMBER_OF_CHANNELS; ++i) {
-        buttons[i]->setIcon(QIcon(":/icons/resources/unmuted.svg"));
+        static_cast<ModernButton*>(buttons[i])->setStateIcons(kIconUnmuted, kIconMuted); // checked = mudo
         buttons[i]->setCheckable(true);
         group->addButton(buttons[i], i);
         connect(titlesArray[i], SIGNAL(clicked(bool)), this, SLOT(changeTitle()));
@@ -829,8 +597,34 @@ MainWindow::MainWindow(QWidget *parent)
     // Carrega labels persistidas
     loadChannelLabels();
 
-    connect(ui->pbConnect,SIGNAL(clicked(bool)),this,SLOT(onConnectButton()));
+    startupWiringMs = startupTimer.elapsed() - startupSetupUiMs;
+}
 
+// ============ Tempo de frame (métricas) + partida: loga no 1º frame pintado ============
+bool MainWindow::event(QEvent* e)
+{
+    if (e->type() != QEvent::UpdateRequest)
+        return QMainWindow::event(e);
+
+    QElapsedTimer frame; frame.start();
+    bool r;
+    {
+        TRACE_SCOPE("ui.frame");
+        r = QMainWindow::event(e); // pinta/sincroniza o backing store
+    }
+    Metrics::add(Metrics::UiFrames);
+    Metrics::record(Metrics::UiFrameUs, quint32(frame.nsecsElapsed() / 1000));
+
+    if (startupLogged) return r;
+    startupLogged = true;
+
+    const qint64 total = startupTimer.elapsed();
+    const qint64 firstPaint = total - startupSetupUiMs - startupWiringMs;
+    const QString msg = QString("Partida: setupUi %1 ms, ligações %2 ms, 1º paint %3 ms (total %4 ms)")
+                            .arg(startupSetupUiMs).arg(startupWiringMs).arg(firstPaint).arg(total);
+    qInfo().noquote() << msg;
+    appendLog(msg, LogBuffer::Debug);
+    return r;
 }
 
 // ====== LR: ACUMULADOR (10 voltas = 100%) ======
@@ -852,11 +646,11 @@ void MainWindow::onLRDialValueChanged(int v)
     lastDialLR = v;
 
     currentFaderLR = accumLR / float(TOTAL); // 0..1 após 10 voltas
-    ui->dial_LR->setProperty("progress01", currentFaderLR);
+    ui->dial_LR->setProgress01(currentFaderLR);
 
     // >>> REFLETE NA UI DO LR <<<
     if (ui->labelPercent_LR)
-        ui->labelPercent_LR->setText(QString::number(currentFaderLR, 'f', 4));
+        ui->labelPercent_LR->setValue(currentFaderLR);
     if (ui->pbarVol_LR)
         ui->pbarVol_LR->setValue(int(std::lround(currentFaderLR * 100.0f)));
 
@@ -866,6 +660,7 @@ void MainWindow::onLRDialValueChanged(int v)
 void MainWindow::onLRDialPressed()
 {
     draggingLR = true;
+    morph->stop();
     // mantemos o timer rodando durante arraste (throttle)
 }
 
@@ -878,17 +673,14 @@ void MainWindow::onLRDialReleased()
 
 void MainWindow::flushLRFaderSend()
 {
+    TRACE_SCOPE("ui.flushLRFaderSend");
     if (!osc) return;
 
     // coalescing leve (igual aos canais)
-    static bool  s_init = false;
-    static float s_lastSent = -1.0f;
-    if (!s_init) { s_lastSent = -1.0f; s_init = true; }
-
     const float v01 = currentFaderLR;
     const float eps = 0.0005f;
-    if (s_lastSent < 0.0f || std::fabs(v01 - s_lastSent) > eps) {
-        s_lastSent = v01;
+    if (s_lastSentLR < 0.0f || std::fabs(v01 - s_lastSentLR) > eps) {
+        s_lastSentLR = v01;
         osc->setMainLRFader(v01);
     }
 }
@@ -896,11 +688,7 @@ void MainWindow::flushLRFaderSend()
 void MainWindow::onMuteToggledLR(bool)
 {
     const bool muted = !ui->pushButton_LR->isChecked();
-
-    // Atualiza ícone (igual já fazia)
-    ui->pushButton_LR->setIcon(QIcon(muted
-                                         ? QStringLiteral(":/icons/resources/muted.svg")
-                                         : QStringLiteral(":/icons/resources/unmuted.svg")));
+    // ícone acompanha o checked (setStateIcons no setup)
 
     // ENVIO OSC para LR: on=1 => unmuted; nosso botão checked=true => muted
     if (osc) {
@@ -908,14 +696,445 @@ void MainWindow::onMuteToggledLR(bool)
     }
 }
 
+// ============ Estado recebido (coalescido por frame) ============
+void MainWindow::schedulePendingRx()
+{
+    if (!rxApplyTimer.isActive()) rxApplyTimer.start();
+}
+
+void MainWindow::applyPendingRx()
+{
+    TRACE_SCOPE("ui.applyPendingRx");
+    // ---- LR on/off -> pushButton_LR (ícone acompanha o checked) ----
+    if (pendingRx.muteLR >= 0 && ui->pushButton_LR) {
+        const bool checked = (pendingRx.muteLR != 0);
+        if (ui->pushButton_LR->isChecked() != checked) {
+            QSignalBlocker block2(ui->pushButton_LR);
+            ui->pushButton_LR->setChecked(checked);
+        }
+    }
+
+    // ---- Fader LR ----
+    if (pendingRx.faderLR >= 0.0f) showLRFader(pendingRx.faderLR);
+
+    for (int idx = 0; idx < NUMBER_OF_CHANNELS; ++idx) {
+        // ---- Fader do canal ----
+        if (pendingRx.fader[idx] >= 0.0f) showChannelFader(idx, pendingRx.fader[idx]);
+
+        // ---- Mute do canal — ATUALIZA UI SEM EMITIR SINAL ----
+        const int onInt = pendingRx.mute[idx];
+        if (onInt >= 0 && buttons[idx]) {
+            const bool shouldChecked = (onInt == 0); // nosso botão checked = muted
+            // só toca no botão se realmente mudou
+            if (buttons[idx]->isChecked() != shouldChecked) {
+                QSignalBlocker block(buttons[idx]); // evita idToggled -> onMuteToggled -> loop
+                buttons[idx]->setChecked(shouldChecked);
+            }
+        }
+    }
+
+    pendingRx.clear();
+}
+
+// Fader (0..1) -> estado + dial/label/barra; usado pelo RX e pelo morph de cenas
+void MainWindow::showChannelFader(int idx, float v01)
+{
+    // Enquanto arrasta, o dial é a verdade: valor de fora seria enviado no release
+    if (dragging[idx]) return;
+
+    currentFaderArr[idx] = v01;
+    if (dials[idx]) dials[idx]->setProgress01(currentFaderArr[idx]);
+    accumArr[idx] = int(v01 * 10000.0f + 0.5f);
+
+    if (dials[idx]) {
+        const int steps = accumArr[idx] % 1000;
+        QSignalBlocker block(dials[idx]);
+        dials[idx]->setValue(steps);
+        lastDialArr[idx] = steps;
+    }
+
+    labelsPercentArray[idx]->setValue(v01);
+    if (percBarsArray[idx]) percBarsArray[idx]->setValue(int(std::lround(v01 * 100.0f)));
+}
+
+void MainWindow::showLRFader(float v01)
+{
+    // Enquanto arrasta, o acumulador do LR segue só o dial (idem canais)
+    if (draggingLR) return;
+
+    currentFaderLR = v01;
+    ui->dial_LR->setProgress01(currentFaderLR);
+    accumLR        = int(v01 * 10000.0f + 0.5f);
+
+    const int steps = accumLR % 1000;
+    {
+        QSignalBlocker block(ui->dial_LR);
+        ui->dial_LR->setValue(steps);
+    }
+    lastDialLR = steps;
+
+    // >>> REFLETE NA UI DO LR <<<
+    if (ui->labelPercent_LR)
+        ui->labelPercent_LR->setValue(v01);
+    if (ui->pbarVol_LR)
+        ui->pbarVol_LR->setValue(int(std::lround(v01 * 100.0f)));
+}
+
 // =================== LOG ===================
-void MainWindow::appendLog(const QString &msg, const QString &color, bool bold, bool italic)
+void MainWindow::appendLog(const QString &msg, LogBuffer::Level level)
+{
+    // só grava no anel; a aba Logs (LogModel) puxa em lote quando existir
+    LogBuffer::instance().write(level, "app", msg);
+}
+
+// ============ Abas montadas sob demanda ============
+void MainWindow::onTabActivated(int index)
+{
+    QWidget* page = ui->tabWidget->widget(index);
+    if (page == ui->tabLogs)        setupLogsTab();
+    else if (page == ui->tabAjuda)  setupHelpTab();
+    else if (page == ui->tabConfig) setupConfigTab();
+}
+
+// Embute o formulário da aba dentro da página (placeholder) do tabWidget
+static QWidget* embedTabForm(QWidget* page, QWidget* form = nullptr)
+{
+    auto* lay = new QVBoxLayout(page);
+    lay->setContentsMargins(0, 0, 0, 0);
+    if (!form) form = new QWidget(page);
+    lay->addWidget(form);
+    return form;
+}
+
+void MainWindow::setupConfigTab()
+{
+    if (statsPanel) return;
+
+    QWidget* form = embedTabForm(ui->tabConfig);
+    auto* lay = new QVBoxLayout(form);
+
+    // consoles simultâneos (um socket, um tick): a troca reaplica o estado guardado
+    auto* consoleRow = new QHBoxLayout;
+    consoleRow->addWidget(new QLabel(tr("Console"), form));
+    consoleCombo = new QComboBox(form);
+    for (int i = 0; i < sessions->count(); ++i) consoleCombo->addItem(sessions->name(i));
+    consoleCombo->setCurrentIndex(sessions->activeIndex());
+    connect(consoleCombo, &QComboBox::currentIndexChanged, this, &MainWindow::switchConsole);
+    consoleRow->addWidget(consoleCombo, 1);
+    auto* addConsoleBtn = new QPushButton(tr("Adicionar"), form);
+    auto* delConsoleBtn = new QPushButton(tr("Remover"), form);
+    for (QPushButton* b : { addConsoleBtn, delConsoleBtn }) {
+        b->setProperty("themeRole", "menu");
+        b->setMinimumSize(100, 35);
+        consoleRow->addWidget(b);
+    }
+    connect(addConsoleBtn, &QPushButton::clicked, this, [this] {
+        bool ok = false;
+        const QString spec = QInputDialog::getText(this, tr("Adicionar console"), tr("Nome@ip:porta"),
+                                                   QLineEdit::Normal, QStringLiteral("Lateral@192.168.1.60:10024"), &ok);
+        if (!ok || spec.trimmed().isEmpty()) return;
+        const int i = addConsole(spec);
+        if (i < 0) return;
+        if (sessions->isOpen()) startSession(sessions->client(i));
+        consoleCombo->addItem(sessions->name(i));
+        saveConsoles();
+    });
+    connect(delConsoleBtn, &QPushButton::clicked, this, [this] {
+        const int i = sessions->activeIndex();
+        if (i == 0) return;                    // a principal (descoberta) fica
+        consoleCombo->setCurrentIndex(0);      // -> switchConsole(0)
+        sessions->remove(i);
+        consoleCombo->removeItem(i);
+        saveConsoles();
+    });
+    lay->addLayout(consoleRow);
+
+    // tempo de transição (crossfade) das cenas; fadeMs no grupo da cena tem prioridade
+    auto* fadeRow = new QHBoxLayout;
+    fadeRow->addWidget(new QLabel(tr("Transição de cena"), form));
+    auto* fade = new QSpinBox(form);
+    fade->setRange(0, 10000);
+    fade->setSingleStep(250);
+    fade->setSuffix(" ms");
+    fade->setValue(sceneFadeMs());
+    connect(fade, &QSpinBox::valueChanged, this, [this](int ms) {
+        scenes->setValue("CONFIG", "sceneFadeMs", ms);
+    });
+    fadeRow->addWidget(fade);
+    fadeRow->addStretch(1);
+    lay->addLayout(fadeRow);
+
+    // cada botão de cena: cena local (INI) ou snapshot do console (/-snap)
+    auto* snapGrid = new QGridLayout;
+    for (int i = 0; i < NUMBER_OF_SCENES; ++i) {
+        const QString key = pbTauArray[i]->property("sceneKey").toString();
+        auto* combo = new QComboBox(form);
+        combo->addItem(tr("Local"), 0);
+        for (int n = 1; n <= OscClient::kSnapshotSlots; ++n)
+            combo->addItem(tr("Console %1").arg(n, 2, 10, QChar('0')), n);
+        combo->setCurrentIndex(qBound(0, sceneSnapshotSlot(key), OscClient::kSnapshotSlots));
+        connect(combo, &QComboBox::currentIndexChanged, this, [this, key](int idx) {
+            scenes->setValue(key, "snap", idx);     // índice = slot (0 = local)
+        });
+        snapCombos[i] = combo;
+        snapGrid->addWidget(new QLabel(key, form), i / 2, (i % 2) * 2);
+        snapGrid->addWidget(combo, i / 2, (i % 2) * 2 + 1);
+    }
+    snapReadButton = new QPushButton(tr("Ler snapshots"), form);
+    snapReadButton->setProperty("themeRole", "menu");
+    snapReadButton->setMinimumSize(100, 35);
+    connect(snapReadButton, &QPushButton::clicked, this, [this]{ osc->requestSnapshotNames(); });
+    snapGrid->addWidget(snapReadButton, (NUMBER_OF_SCENES + 1) / 2, 3);
+    lay->addLayout(snapGrid);
+    updateSnapshotUi();
+
+    // show (.oscshow): todas as cenas + labels num arquivo binário
+    auto* showRow = new QHBoxLayout;
+    showRow->addStretch(1);
+    auto* openShow = new QPushButton(tr("Abrir show"), form);
+    auto* saveShow = new QPushButton(tr("Salvar show"), form);
+    for (QPushButton* b : { openShow, saveShow }) {
+        b->setProperty("themeRole", "menu");
+        b->setMinimumSize(100, 35);
+        showRow->addWidget(b);
+    }
+    connect(openShow, &QPushButton::clicked, this, &MainWindow::onOpenShow);
+    connect(saveShow, &QPushButton::clicked, this, &MainWindow::onSaveShow);
+
+    // proxy: este tablet segura a sessão com o console e serve os outros
+    proxyButton = new QPushButton(tr("Proxy OSC"), form);
+    proxyButton->setProperty("themeRole", "menu");
+    proxyButton->setMinimumSize(100, 35);
+    proxyButton->setCheckable(true);
+    proxyButton->setChecked(proxy && proxy->isRunning());
+    connect(proxyButton, &QPushButton::toggled, this, [this](bool on) {
+        if (!setProxyEnabled(on)) { QSignalBlocker b(proxyButton); proxyButton->setChecked(false); }
+    });
+    showRow->insertWidget(1, proxyButton);
+    lay->addLayout(showRow);
+
+    connect(sessions, &MixerSessions::snapshotName, this, [this](int slot, const QString& name) {
+        const QString text = name.isEmpty() ? tr("Console %1").arg(slot, 2, 10, QChar('0'))
+                                            : tr("Console %1 — %2").arg(slot, 2, 10, QChar('0')).arg(name);
+        for (QComboBox* c : snapCombos) if (c) c->setItemText(slot, text);
+    });
+
+    statsPanel = new StatsPanel(form);
+    statsPanel->setOscClient(osc);
+    lay->addWidget(statsPanel, 1);
+}
+
+void MainWindow::setupLogsTab()
+{
+    if (logsUi) return;
+
+    logsUi = new Ui::LogsTab;
+    logsUi->setupUi(embedTabForm(ui->tabLogs));
+
+    connect(logsUi->pbConnect,SIGNAL(clicked(bool)),this,SLOT(onConnectButton()));
+
+    // IP/porta de entrada: o último digitado (INI) ou o padrão do .ui
+    const QString ip   = scenes->value("CONFIG", "mixerIp").toString();
+    const QString port = scenes->value("CONFIG", "mixerPort").toString();
+    if (!ip.isEmpty())   logsUi->lineEditIP->setText(ip);
+    if (!port.isEmpty()) logsUi->lineEditPort->setText(port);
+    connect(logsUi->lineEditIP, &QLineEdit::editingFinished, this, [this] {
+        scenes->setValue("CONFIG", "mixerIp", logsUi->lineEditIP->text().trimmed());
+    });
+    connect(logsUi->lineEditPort, &QLineEdit::editingFinished, this, [this] {
+        scenes->setValue("CONFIG", "mixerPort", logsUi->lineEditPort->text().trimmed());
+    });
+
+    connect(logsUi->pbExportLogs, &QPushButton::clicked, this, &MainWindow::onExportLogs);
+
+    // lista virtualizada sobre o anel; o modelo já traz o que foi logado antes da aba existir
+    logModel = new LogModel(this);
+    logsUi->listLogs->setModel(logModel);
+
+    // segue o fim só se o usuário já estava no fim (não "puxa" quem está lendo o histórico)
+    QScrollBar* sb = logsUi->listLogs->verticalScrollBar();
+    connect(logModel, &QAbstractItemModel::rowsAboutToBeInserted, this, [this, sb]() {
+        logFollowTail = sb->value() >= sb->maximum();
+    });
+    connect(logModel, &QAbstractItemModel::rowsInserted, this, [this]() {
+        if (logFollowTail) logsUi->listLogs->scrollToBottom();
+    });
+    logsUi->listLogs->scrollToBottom();
+}
+
+void MainWindow::onExportLogs()
+{
+    if (!logModel) return;
+    logModel->pull(); // inclui o que ainda está só no anel
+
+    const QString dir = QStandardPaths::writableLocation(QStandardPaths::DocumentsLocation);
+    QDir().mkpath(dir);
+    const QString path = dir + "/osccb-log-" + QDateTime::currentDateTime().toString("yyyyMMdd-hhmmss") + ".txt";
+
+    QFile f(path);
+    if (!f.open(QIODevice::WriteOnly | QIODevice::Text) || !logModel->exportText(&f)) {
+        appendLog("Falha ao exportar logs para " + path, LogBuffer::Error);
+        return;
+    }
+    appendLog("Logs exportados para " + path, LogBuffer::Notice);
+}
+
+// ============ Proxy OSC ============
+bool MainWindow::setProxyEnabled(bool on, quint16 port)
+{
+    if (!on) {
+        if (proxy) proxy->stop();
+        return true;
+    }
+    if (!proxy) {
+        // sempre a sessão principal (não sai com remove(); a ativa pode sair)
+        proxy = new OscProxy(sessions->client(0), this);
+        connect(proxy, &OscProxy::peersChanged, this, [this](int n) {
+            if (proxyButton) proxyButton->setText(n > 0 ? tr("Proxy OSC (%1)").arg(n) : tr("Proxy OSC"));
+        });
+    }
+    return proxy->start(port);
+}
+
+// ============ Show (.oscshow) ============
+void MainWindow::onSaveShow()
+{
+    // retrato dos parâmetros atuais junto com as cenas
+    QList<ShowParam> params;
+    auto add = [&params](const QString& path, quint32 type, quint32 bits) {
+        ShowParam p{};
+        const QByteArray u = path.toLatin1().left(int(sizeof(p.path)) - 1);
+        std::memcpy(p.path, u.constData(), size_t(u.size()));
+        p.type = type;
+        p.bits = bits;
+        params.append(p);
+    };
+    auto floatBits = [](float f) { quint32 b; std::memcpy(&b, &f, 4); return b; };
+    for (int ch = 0; ch < NUMBER_OF_CHANNELS; ++ch) {
+        const QString base = QString("/ch/%1/mix/").arg(ch + 1, 2, 10, QChar('0'));
+        add(base + "fader", 'f', floatBits(currentFaderArr[ch]));
+        add(base + "on",    'i', buttons[ch]->isChecked() ? 0u : 1u);
+    }
+    add("/lr/mix/fader", 'f', floatBits(currentFaderLR));
+    add("/lr/mix/on",    'i', ui->pushButton_LR->isChecked() ? 1u : 0u);
+
+    const QString dir = QStandardPaths::writableLocation(QStandardPaths::DocumentsLocation);
+    QDir().mkpath(dir);
+    const QString path = dir + "/osccb-show-" + QDateTime::currentDateTime().toString("yyyyMMdd-hhmmss") + ".oscshow";
+
+    QString err;
+    if (!ShowFile::exportStore(*scenes, params, path, &err)) {
+        appendLog("Falha ao salvar show: " + err, LogBuffer::Error);
+        return;
+    }
+    appendLog("Show salvo em " + path, LogBuffer::Notice);
+}
+
+void MainWindow::onOpenShow()
 {
-    QString style = QString("color:%1;").arg(color);
-    if (bold)   style += "font-weight:bold;";
-    if (italic) style += "font-style:italic;";
-    QString html = QString("<span style='%1'>%2</span>").arg(style, msg.toHtmlEscaped());
-    ui->textEdit->append(html);
+    const QString dir = QStandardPaths::writableLocation(QStandardPaths::DocumentsLocation);
+    const QString path = QFileDialog::getOpenFileName(this, tr("Abrir show"), dir, tr("Show (*.oscshow)"));
+    if (path.isEmpty()) return;
+
+    ShowFile show;
+    QString err;
+    if (!show.open(path, &err)) {
+        appendLog("Falha ao abrir show: " + err, LogBuffer::Error);
+        return;
+    }
+    show.importInto(*scenes);   // vira o profiles.ini (gravado em segundo plano)
+    loadChannelLabels();
+    const int sent = applyShowParams(show);
+    appendLog(QString("Show aberto: %1 cena(s), %2 label(s), %3 parâmetro(s) no console")
+                  .arg(show.sceneCount()).arg(show.labelCount()).arg(sent),
+              LogBuffer::Notice);
+}
+
+// Retrato de parâmetros do show -> UI + console, num bundle só (como o recall de cena).
+// Fader/mute de canal e LR passam pelos caminhos da UI (dedupe do envio);
+// o resto vai como está gravado.
+int MainWindow::applyShowParams(const ShowFile& show)
+{
+    if (!osc || show.paramCount() == 0) return 0;
+    morph->stop();
+
+    int sent = 0;
+    osc->beginBundle();
+    for (int i = 0; i < show.paramCount(); ++i) {
+        const ShowParam& p = show.param(i);
+        const QString path = QString::fromLatin1(p.path, int(qstrnlen(p.path, sizeof(p.path))));
+        float f; std::memcpy(&f, &p.bits, 4);
+        const bool isFader = path.endsWith(QLatin1String("/mix/fader"));
+        const bool isOn    = path.endsWith(QLatin1String("/mix/on"));
+
+        if (path.startsWith(QLatin1String("/ch/")) && (isFader || isOn)) {
+            bool ok = false;
+            const int idx = path.mid(4, 2).toInt(&ok) - 1;
+            if (!ok || idx < 0 || idx >= NUMBER_OF_CHANNELS) continue;
+            if (isFader) { showChannelFader(idx, qBound(0.0f, f, 1.0f)); flushFaderSend(idx); }
+            else         applySceneMute(idx, p.bits == 0);     // mixer: on = 1
+        } else if (path == QLatin1String("/lr/mix/fader")) {
+            showLRFader(qBound(0.0f, f, 1.0f));
+            flushLRFaderSend();
+        } else if (path == QLatin1String("/lr/mix/on")) {
+            applySceneMuteLR(p.bits == 0);
+        } else if (p.type == 'f') {
+            osc->sendRaw(OscClient::encode(path, "f", { OscClient::packFloat(f) }));
+        } else if (p.type == 'i') {
+            osc->sendRaw(OscClient::encode(path, "i", { OscClient::packInt32(qint32(p.bits)) }));
+        } else {
+            continue;
+        }
+        ++sent;
+    }
+    osc->endBundle();
+    return sent;
+}
+
+void MainWindow::setupHelpTab()
+{
+    if (helpUi) return;
+
+    helpUi = new Ui::HelpTab;
+    helpUi->setupUi(embedTabForm(ui->tabAjuda));
+
+    //REF:HELP
+    helpButtons[0] = helpUi->pbHelp_01; helpButtons[1] = helpUi->pbHelp_02; helpButtons[2] = helpUi->pbHelp_03; helpButtons[3] = helpUi->pbHelp_04;
+    helpButtons[4] = helpUi->pbHelp_05; helpButtons[5] = helpUi->pbHelp_06; helpButtons[6] = helpUi->pbHelp_07; helpButtons[7] = helpUi->pbHelp_08;
+    helpButtons[8] = helpUi->pbHelp_09;
+
+    this->helpGroup = new QButtonGroup(this);
+    this->helpGroup->setExclusive(true);
+
+    for (uint8_t i=0; i< NUMBER_OF_HELPS;i++){
+        this->helpGroup->addButton(this->helpButtons[i]);
+        helpButtons[i]->setProperty("pageIndex", i);
+        connect(helpButtons[i], &QPushButton::clicked,this, &MainWindow::onHelpButtonsClicked);
+    }
+
+    connect(helpUi->btRotuloHELP, SIGNAL(clicked(bool)), this, SLOT(changeTitle()));
+
+    //MUTE DO EXEMPLO DO HELP
+    helpUi->pbMuteHELP->setCheckedColor("#00C853");
+    helpUi->pbMuteHELP->setNormalColor("red");
+    helpUi->pbMuteHELP->setHoverColor("red");
+    helpUi->pbMuteHELP->setPressedColor("red");
+    helpUi->pbMuteHELP->setStateIcons(kIconMuted, kIconUnmuted); // checked = aberto
+    connect(helpUi->pbMuteHELP,SIGNAL(clicked(bool)),this,SLOT(pbMuteHelpSlot()));
+
+    //DIAL HELP
+    helpUi->dial_HELP->setWrapping(true);
+    helpUi->dial_HELP->setNotchesVisible(false);
+    helpUi->dial_HELP->setRange(0, 999);       // 1 volta = 1000 passos
+    helpUi->dial_HELP->setSingleStep(1);
+    helpUi->dial_HELP->setPageStep(10);
+
+    helpUi->dial_HELP->setProperty("turns", 10);            // visual: 10 voltas
+    helpUi->dial_HELP->setProperty("fullCircle", true);
+    helpUi->dial_HELP->setProperty("displayTurnPercent", false); // texto = % total
+    helpUi->dial_HELP->setProperty("showValue", true);
+
+    // Aparência: cores/espessura vêm do OsccbStyle (polish)
 }
 
 // ============ Inline edit dos títulos ============
@@ -967,28 +1186,20 @@ void MainWindow::saveChannelLabel(QAbstractButton* b)
     const QString key = b->property("labelKey").toString();
     if (key.isEmpty()) return;
 
-    QSettings s(profilesIniPath(), QSettings::IniFormat);
-    s.setFallbacksEnabled(false);
-    s.beginGroup("LABELS");
-    s.setValue(key, b->text());
-    s.endGroup();
-    s.sync();
+    scenes->setValue("LABELS", key, b->text());
 }
 
 void MainWindow::loadChannelLabels()
 {
-    QSettings s(profilesIniPath(), QSettings::IniFormat);
-    s.setFallbacksEnabled(false);
-    s.beginGroup("LABELS");
+    const QVariantMap labels = scenes->group("LABELS");
     for (int i = 0; i < NUMBER_OF_CHANNELS; ++i) {
         auto *btn = titlesArray[i];
         if (!btn) continue;
         const QString key = btn->property("labelKey").toString();
         if (key.isEmpty()) continue;
-        const QString t = s.value(key, btn->text()).toString();
+        const QString t = labels.value(key, btn->text()).toString();
         btn->setText(t);
     }
-    s.endGroup();
 }
 
 // ============ Dial (10 voltas, envio OSC com throttle) ============
@@ -1002,6 +1213,7 @@ void MainWindow::onDialValueChanged(int v)
     bool ok = false;
     int idx = parts.at(1).toInt(&ok);
     if (!ok || idx < 0 || idx >= NUMBER_OF_CHANNELS) return;
+    TRACE_SCOPE_ID("ui.dialValueChanged", idx);
 
     const int STEPS = 1000;
     const int TOTAL = 10000;
@@ -1025,47 +1237,148 @@ void MainWindow::onDialValueChanged(int v)
 
     currentFaderArr[idx] = accum / float(TOTAL); // 0..1
 
-    if (dials[idx]) dials[idx]->setProperty("progress01", currentFaderArr[idx]);
+    if (dials[idx]) dials[idx]->setProgress01(currentFaderArr[idx]);
 
 
     const float perc = currentFaderArr[idx] * 100.0f;
-    labelsPercentArray[idx]->setText(QString::number(currentFaderArr[idx], 'f', 4));
+    labelsPercentArray[idx]->setValue(currentFaderArr[idx]);
     if (percBarsArray[idx]) percBarsArray[idx]->setValue(int(std::lround(perc)));
 
     // Sempre agenda envio com throttle (~30 Hz), mesmo arrastando
-    if (sendTimers[idx]) sendTimers[idx]->start();
+    if (sendTimers[idx]) {
+        TRACE_INSTANT("ui.sendTimer.arm", idx);
+        sendTimers[idx]->start();
+    }
 }
 
 void MainWindow::onConnectButton()
 {
     osc->close();
     QTimer::singleShot(0, this, [this]() {
-        if (!osc->open(LOCAL_PORT_BIND)) { //ATENCAO: ISSO É PORTA LOCAL, DO APP
-            appendLog("Falha ao abrir UDP local. Não operativo.", "red", true, false);
+        if (!sessions->open(LOCAL_PORT_BIND)) { //ATENCAO: ISSO É PORTA LOCAL, DO APP
+            appendLog("Falha ao abrir UDP local. Não operativo.", LogBuffer::Error);
             return;
         }
 
         QTimer::singleShot(0, this, [this]() {
-            const bool found = osc->setTargetFromDiscovery("192.168.1.0/24", 3500);
-            if (!found) {
-                appendLog("Mixer não encontrado via scan. Tentando IP de entrada...", "yellow", true, false);
-                osc->setTarget(QHostAddress(ui->lineEditIP->text()), ui->lineEditPort->text().toInt());
-            } else {
-                qDebug() << "Mixer em" << osc->targetAddress() << osc->targetPort();
-                appendLog("Mixer em " + osc->targetAddress().toString().toUtf8(), "cyan", false, true);
+            // só a sessão principal redescobre; as outras reconectam no IP delas
+            if (sessions->activeIndex() == 0) {
+                const bool found = osc->setTargetFromDiscovery("192.168.1.0/24", 3500);
+                if (!found) {
+                    appendLog("Mixer não encontrado via scan. Tentando IP de entrada...", LogBuffer::Warning);
+                    osc->setTarget(QHostAddress(logsUi->lineEditIP->text()), logsUi->lineEditPort->text().toInt());
+                } else {
+                    qDebug() << "Mixer em" << osc->targetAddress() << osc->targetPort();
+                    appendLog("Mixer em " + osc->targetAddress().toString(), LogBuffer::Info);
+                }
             }
-            osc->queryName();
-
-            osc->startFeedbackKeepAlive(5000);
-            osc->subscribeMetersAllChannels();
-            osc->subscribeMetersLR();
-            osc->syncAll(NUMBER_OF_CHANNELS);   // GET inicial (fader+mute) dos canais
-
+            startSession(osc);
         });
     });
 
 }
 
+// ============ Consoles (MixerSessions) ============
+void MainWindow::startSession(OscClient* c)
+{
+    c->queryName();
+
+    c->startFeedbackKeepAlive(5000);
+    c->subscribeMetersAllChannels();
+    c->subscribeMetersLR();
+    c->syncAll(NUMBER_OF_CHANNELS);   // GET inicial (fader+mute) dos canais
+}
+
+// "Nome@ip[:porta]" (CONFIG/consoles e diálogo da aba Config)
+int MainWindow::addConsole(const QString& spec)
+{
+    const int at = spec.lastIndexOf('@');
+    const QString name = spec.left(at).trimmed();
+    const QStringList hp = spec.mid(at + 1).trimmed().split(':');
+    const QHostAddress addr(hp.value(0));
+    const quint16 port = quint16(hp.value(1, "10024").toUInt());
+    if (at <= 0 || addr.isNull() || port == 0) {
+        appendLog("Console inválido (use Nome@ip:porta): " + spec, LogBuffer::Warning);
+        return -1;
+    }
+    return addConsole(name, addr, port);
+}
+
+int MainWindow::addConsole(const QString& name, const QHostAddress& addr, quint16 port)
+{
+    const int i = sessions->add(name, addr, port);
+    // erros vão direto ao anel de logs (barato, sem tocar na UI)
+    OscClient* c = sessions->client(i);
+    connect(c, &OscClient::error, this, [name](const QString& m){ logError("osc", name + ": " + m); });
+    connect(c, &OscClient::modelChanged, this, [this, c]{ if (c == osc) updateSnapshotUi(); });
+    return i;
+}
+
+void MainWindow::saveConsoles()
+{
+    QStringList specs;
+    for (int i = 1; i < sessions->count(); ++i) {
+        const OscClient* c = sessions->client(i);
+        specs << QString("%1@%2:%3").arg(sessions->name(i), c->targetAddress().toString()).arg(c->targetPort());
+    }
+    scenes->setValue("CONFIG", "consoles", specs);
+}
+
+void MainWindow::switchConsole(int index)
+{
+    if (index == sessions->activeIndex() || index < 0 || index >= sessions->count()) return;
+    TRACE_SCOPE("ui.switchConsole");
+
+    // o que está em trânsito termina no console que estava na tela
+    morph->stop();
+    for (int i = 0; i < NUMBER_OF_CHANNELS; ++i)
+        if (sendTimers[i] && sendTimers[i]->isActive()) { sendTimers[i]->stop(); flushFaderSend(i); }
+    if (sendTimerLR && sendTimerLR->isActive()) { sendTimerLR->stop(); flushLRFaderSend(); }
+
+    // o console não ecoa para quem mandou: o estado da UI fica guardado na sessão que sai
+    MixerSessions::State& out = sessions->state(sessions->activeIndex());
+    for (int i = 0; i < NUMBER_OF_CHANNELS; ++i) {
+        out.fader[i] = currentFaderArr[i];
+        out.mute[i]  = buttons[i]->isChecked() ? 0 : 1;   // checked = mudo
+    }
+    out.faderLR = currentFaderLR;
+    out.muteLR  = ui->pushButton_LR->isChecked() ? 1 : 0; // LR: checked = aberto
+
+    sessions->setActive(index);
+    osc = sessions->active();
+    resetSendCache();
+    if (statsPanel) statsPanel->setOscClient(osc);
+    updateSnapshotUi();
+
+    // estado guardado -> UI já neste frame, sem GET ao mixer.
+    // Desconhecido (sessão que ainda não respondeu) vira 0 / aberto: nada do console
+    // anterior fica na tela (o próximo toque mandaria para o console errado)
+    const MixerSessions::State& in = sessions->state(index);
+    rxApplyTimer.stop();
+    pendingRx.clear();
+    bool unknown = in.faderLR < 0.0f || in.muteLR < 0;
+    for (int i = 0; i < NUMBER_OF_CHANNELS; ++i) {
+        unknown |= in.fader[i] < 0.0f || in.mute[i] < 0;
+        pendingRx.fader[i] = in.fader[i] < 0.0f ? 0.0f : in.fader[i];
+        pendingRx.mute[i]  = in.mute[i]  < 0    ? 1    : in.mute[i];
+    }
+    pendingRx.faderLR = in.faderLR < 0.0f ? 0.0f : in.faderLR;
+    pendingRx.muteLR  = in.muteLR  < 0    ? 1    : in.muteLR;
+    applyPendingRx();
+    // ... e o valor real vem por RX (applyPendingRx)
+    if (unknown) osc->syncAll(NUMBER_OF_CHANNELS);
+
+    // meters: último frame da sessão (ausente = zero); o timer de UI pinta no próximo tick
+    const MixerProfile& prof = osc->profile();
+    if (prof.acceptChannelMeters(in.meters1)) prof.channelMeters(in.meters1, g_nextPctCh, kNumUiCh);
+    else std::fill_n(g_nextPctCh, kNumUiCh, 0);
+    if (prof.acceptLRMeters(in.meters3)) prof.lrMeters(in.meters3, g_nextPctLR);
+    else std::fill_n(g_nextPctLR, 2, 0);
+
+    appendLog(QString("Console ativo: %1 (%2)").arg(sessions->name(index), QLatin1String(osc->caps().name)),
+              LogBuffer::Notice);
+}
+
 void MainWindow::onDialPressed()
 {
     QDial* dial = qobject_cast<QDial*>(sender());
@@ -1076,6 +1389,7 @@ void MainWindow::onDialPressed()
     if (!ok || idx < 0 || idx >= NUMBER_OF_CHANNELS) return;
 
     dragging[idx] = true;
+    morph->stop();     // mão no fader vence a transição de cena
     // não paramos o timer — enviamos durante o arrasto com throttle
 }
 
@@ -1093,19 +1407,26 @@ void MainWindow::onDialReleased()
     flushFaderSend(idx); // envio final imediato quando solta
 }
 
+// ============ Taxa de envio adaptativa ============
+// Não adianta mandar sets mais rápido que o mixer responde: com a rede lenta
+// eles só enfileiram. Intervalo = p95 recente do RTT, entre 33 e 100 ms.
+void MainWindow::onLatencyChanged(int p95Ms)
+{
+    const int interval = qBound(kSendIntervalMinMs, p95Ms, kSendIntervalMaxMs);
+    if (sendTimerLR && sendTimerLR->interval() == interval) return;
+
+    for (int i = 0; i < NUMBER_OF_CHANNELS; ++i)
+        if (sendTimers[i]) sendTimers[i]->setInterval(interval);
+    if (sendTimerLR) sendTimerLR->setInterval(interval);
+}
+
 void MainWindow::flushFaderSend(int idx)
 {
+    TRACE_SCOPE_ID("ui.flushFaderSend", idx);
     if (!osc) return;
     if (idx < 0 || idx >= NUMBER_OF_CHANNELS) return;
 
     // Coalescing: só envia se mudou (epsilon)
-    static bool s_init = false;
-    static float s_lastSentFader[NUMBER_OF_CHANNELS];
-    if (!s_init) {
-        for (int i=0;i<NUMBER_OF_CHANNELS;i++) s_lastSentFader[i] = -1.0f;
-        s_init = true;
-    }
-
     const float v01 = currentFaderArr[idx];
     const float last = s_lastSentFader[idx];
     const float eps  = 0.0005f; // ~0.05%
@@ -1123,25 +1444,31 @@ void MainWindow::onSaveActiveSceneClicked()
     if (!b) return;
 
     const QString key = b->property("sceneKey").toString(); // INICIO, ORACAO, ...
-    QSettings s(profilesIniPath(), QSettings::IniFormat);
-    s.setFallbacksEnabled(false);
-
-    s.beginGroup(key);
+    // mutes (m%1), faders (f%1) e o LR; fadeMs (se houver no INI) é preservado
+    QVariantMap scene = scenes->group(key);
     for (uint8_t i = 0; i < NUMBER_OF_CHANNELS; ++i) {
-        s.setValue(QString("m%1").arg(i), buttons[i]->isChecked());
+        scene.insert(QString("m%1").arg(i), buttons[i]->isChecked());
+        scene.insert(QString("f%1").arg(i), currentFaderArr[i]);
+    }
+    scene.insert("mLR", !ui->pushButton_LR->isChecked());   // LR: checked = aberto
+    scene.insert("fLR", currentFaderLR);
+    scenes->setGroup(key, scene);
+
+    // mapeada num snapshot: grava também no console (nome = chave da cena)
+    if (const int slot = sceneSnapshotSlot(key); slot > 0) {
+        osc->beginBundle();
+        osc->setSnapshotName(key);
+        osc->saveSnapshot(slot);
+        osc->endBundle();
+        appendLog(QString("Cena %1 salva no snapshot %2 do console").arg(key).arg(slot));
     }
-    s.endGroup();
-    s.sync();
 }
 
 void MainWindow::onMuteToggled(int id, bool checked)
 {
     if (id < 0 || id >= NUMBER_OF_CHANNELS) return;
 
-    // UI: ícone continua como estava (sua convenção)
-    buttons[id]->setIcon(QIcon(checked
-                                   ? QStringLiteral(":/icons/resources/muted.svg")
-                                   : QStringLiteral(":/icons/resources/unmuted.svg")));
+    // UI: ícone acompanha o checked (setStateIcons no setup; checked = mudo)
 
     // Convenção do mixer: /ch/NN/mix/on = 1 => canal LIGADO (unmuted)
     // Nosso botão: checked=true => MUTED. Logo enviamos on = !checked.
@@ -1175,7 +1502,7 @@ void MainWindow::onMinusLRClicked()
     accumLR = units;
 
     currentFaderLR = accumLR / 10000.0f;
-    ui->dial_LR->setProperty("progress01", currentFaderLR);
+    ui->dial_LR->setProgress01(currentFaderLR);
 
 
     // move o dial sem emitir signals (0..999)
@@ -1188,7 +1515,7 @@ void MainWindow::onMinusLRClicked()
 
     // atualiza UI (label e barra)
     if (ui->labelPercent_LR)
-        ui->labelPercent_LR->setText(QString::number(currentFaderLR, 'f', 4));
+        ui->labelPercent_LR->setValue(currentFaderLR);
     if (ui->pbarVol_LR)
         ui->pbarVol_LR->setValue(int(std::lround(currentFaderLR * 100.0f)));
 
@@ -1220,12 +1547,12 @@ void MainWindow::onMinusClicked()
         lastDialArr[idx] = steps;
 
         if (dials[idx]) {
-            dials[idx]->setProperty("progress01", currentFaderArr[idx]);
+            dials[idx]->setProgress01(currentFaderArr[idx]);
         }
     }
 
     const float perc = accumArr[idx] / 100.0f;
-    labelsPercentArray[idx]->setText(QString::number(perc/100.0f, 'f', 4));
+    labelsPercentArray[idx]->setValue(perc/100.0f);
     if (percBarsArray[idx]) percBarsArray[idx]->setValue(int(std::lround(perc)));
 }
 
@@ -1253,12 +1580,12 @@ void MainWindow::onPlusClicked()
         lastDialArr[idx] = steps;
 
         if (dials[idx]) {
-            dials[idx]->setProperty("progress01", currentFaderArr[idx]);
+            dials[idx]->setProgress01(currentFaderArr[idx]);
         }
     }
 
     const float perc = accumArr[idx] / 100.0f;
-    labelsPercentArray[idx]->setText(QString::number(perc/100.0f, 'f', 4));
+    labelsPercentArray[idx]->setValue(perc/100.0f);
     if (percBarsArray[idx]){
         percBarsArray[idx]->setValue(int(std::lround(perc)));
 
@@ -1269,19 +1596,146 @@ void MainWindow::onPlusClicked()
 void MainWindow::onSceneClicked(QAbstractButton* b)
 {
     const QString key = b->property("sceneKey").toString();
-    QSettings s(profilesIniPath(), QSettings::IniFormat);
-    s.setFallbacksEnabled(false);
+    // Cena mapeada num snapshot do console: 1 datagrama, o mixer faz o resto
+    if (const int slot = sceneSnapshotSlot(key); slot > 0) {
+        morph->stop();
+        osc->loadSnapshot(slot);
+        appendLog(QString("Cena %1: snapshot %2 do console").arg(key).arg(slot));
+        // o /xremote nem sempre ecoa tudo que o snapshot mudou: relê fader/mute
+        QTimer::singleShot(kSnapshotResyncMs, this, [this]{ osc->syncAll(NUMBER_OF_CHANNELS); });
+        return;
+    }
 
-    if (!s.childGroups().contains(key))
+    if (!scenes->hasGroup(key))
         return;
 
-    s.beginGroup(key);
+    TRACE_SCOPE("ui.sceneRecall");
+    // recall servido da memória (SceneStore), sem tocar no disco
+    const QVariantMap scene = scenes->group(key);
+
+    // Diff contra o estado atual (botões espelham o mixer via applyPendingRx):
+    // só os canais que mudam entram. Abrir canal vai já (no bundle de partida);
+    // mutar fica para o fim do crossfade (o som não "corta" antes do fader descer).
+    morph->stop();
+    morphMuteAtEnd.clear();
+    morphMuteLRAtEnd = false;
+
+    int changed = 0;
+    osc->beginBundle();
     for (int ch = 0; ch < NUMBER_OF_CHANNELS; ++ch) {
-        const bool mute = s.value(QString("m%1").arg(ch), false).toBool();
+        // canal fora da cena (sem m%1) fica como está, como nos faders
+        const QVariant m = scene.value(QString("m%1").arg(ch));
+        if (!m.isValid()) continue;
+        const bool mute = m.toBool();
+        if (buttons[ch]->isChecked() == mute) continue;
+        ++changed;
+        if (mute) morphMuteAtEnd.append(ch);
+        else      applySceneMute(ch, false);
+    }
+    if (scene.contains("mLR")) {
+        const bool muteLR = scene.value("mLR").toBool();
+        if (ui->pushButton_LR->isChecked() == muteLR) {   // checked = aberto: diferente do alvo
+            if (muteLR) morphMuteLRAtEnd = true;
+            else        applySceneMuteLR(false);
+        }
+    }
+    osc->endBundle();
+
+    // Faders: só os que a cena tem (cenas antigas só guardavam mutes)
+    QVector<float> from(NUMBER_OF_CHANNELS + 1), to(NUMBER_OF_CHANNELS + 1, -1.0f);
+    for (int ch = 0; ch < NUMBER_OF_CHANNELS; ++ch) {
+        from[ch] = currentFaderArr[ch];
+        const QVariant f = scene.value(QString("f%1").arg(ch));
+        if (f.isValid()) to[ch] = qBound(0.0f, f.toFloat(), 1.0f);
+    }
+    from[NUMBER_OF_CHANNELS] = currentFaderLR;
+    if (scene.contains("fLR")) to[NUMBER_OF_CHANNELS] = qBound(0.0f, scene.value("fLR").toFloat(), 1.0f);
+
+    morphInScene.resize(to.size());
+    bool anyFader = false;
+    for (int i = 0; i < to.size(); ++i) anyFader |= (morphInScene[i] = to[i] >= 0.0f);
+
+    // só mutes (cena antiga): nada a esperar
+    if (!anyFader) {
+        appendLog(QString("Cena %1: %2 mute(s), sem faders").arg(key).arg(changed));
+        onMorphFinished();
+        return;
+    }
+
+    const int fadeMs = scene.value("fadeMs", sceneFadeMs()).toInt();
+    appendLog(QString("Cena %1: %2 mute(s), transição %3 ms").arg(key).arg(changed).arg(fadeMs));
+    morph->start(from, to, fadeMs);
+}
+
+// Mute de cena: UI sem idToggled -> onMuteToggled (seria 1 datagrama por canal);
+// o envio entra no bundle aberto pelo chamador
+void MainWindow::applySceneMute(int ch, bool mute)
+{
+    {
+        QSignalBlocker block(buttons[ch]);
         buttons[ch]->setChecked(mute);
-        // osc->setChannelMute(ch + 1, mute);
     }
-    s.endGroup();
+    const int onToSend = mute ? 0 : 1;     // checked = mudo; mixer: on = 1
+    s_lastMuteSent[ch] = onToSend;
+    osc->setChannelMute(ch + 1, onToSend);
+}
+
+void MainWindow::applySceneMuteLR(bool mute)
+{
+    {
+        QSignalBlocker block(ui->pushButton_LR);
+        ui->pushButton_LR->setChecked(!mute);  // LR: checked = aberto
+    }
+    osc->setMainLRMute(!mute);
+}
+
+int MainWindow::sceneSnapshotSlot(const QString& key) const
+{
+    // console sem /-snap (X32/M32): a cena vale como local, o mapeamento fica guardado
+    const int slot = scenes->value(key, "snap", 0).toInt();
+    return slot <= osc->caps().snapshots ? slot : 0;
+}
+
+void MainWindow::updateSnapshotUi()
+{
+    const bool on = osc->caps().snapshots > 0;
+    const QString tip = on ? QString() : tr("%1 não tem snapshots por OSC").arg(QLatin1String(osc->caps().name));
+    for (QComboBox* c : snapCombos) if (c) { c->setEnabled(on); c->setToolTip(tip); }
+    if (snapReadButton) { snapReadButton->setEnabled(on); snapReadButton->setToolTip(tip); }
+}
+
+int MainWindow::sceneFadeMs() const
+{
+    return scenes->value("CONFIG", "sceneFadeMs", kSceneFadeDefaultMs).toInt();
+}
+
+// Um passo do crossfade: UI + envio de todos os faders num bundle (dedupe no flush)
+void MainWindow::onMorphFrame(const QVector<float>& v)
+{
+    TRACE_SCOPE("ui.morphFrame");
+    osc->beginBundle();
+    // fora da cena: nem UI nem envio (o que chegar do console no meio do fade vale)
+    for (int ch = 0; ch < NUMBER_OF_CHANNELS; ++ch) {
+        if (!morphInScene.value(ch) || dragging[ch]) continue;   // quem está no dial manda
+        showChannelFader(ch, v[ch]);
+        flushFaderSend(ch);
+    }
+    if (morphInScene.value(NUMBER_OF_CHANNELS) && !draggingLR) {
+        showLRFader(v[NUMBER_OF_CHANNELS]);
+        flushLRFaderSend();
+    }
+    osc->endBundle();
+}
+
+void MainWindow::onMorphFinished()
+{
+    if (morphMuteAtEnd.isEmpty() && !morphMuteLRAtEnd) return;
+    osc->beginBundle();
+    for (int ch : std::as_const(morphMuteAtEnd)) applySceneMute(ch, true);
+    if (morphMuteLRAtEnd) applySceneMuteLR(true);
+    osc->endBundle();
+    morphMuteAtEnd.clear();
+    morphMuteLRAtEnd = false;
 }
 
 void MainWindow::onHelpButtonsClicked()
@@ -1291,10 +1745,16 @@ void MainWindow::onHelpButtonsClicked()
 
     const int idx = b->property("pageIndex").toInt();
 
-    ui->textBrowser->clear();
-    ui->textBrowser->setText(helpTexts.length()-1 > idx ? html_start + helpTexts.at(idx+1) + html_end : html_start + "<h3>A Ajuda para esse item não foi implementada nessa versão</h3>" + html_end);
+    // textos de ajuda ficam no .qrc (comprimidos) e só são lidos ao tocar no botão
+    QString body = "<h3>A Ajuda para esse item não foi implementada nessa versão</h3>";
+    QFile f(QString(":/help/resources/help/help_%1.html").arg(idx + 1, 2, 10, QChar('0')));
+    if (f.open(QIODevice::ReadOnly))
+        body = QString::fromUtf8(f.readAll());
 
-    ui->stackedWidget->setCurrentIndex(idx > ui->stackedWidget->count() ? 0 : idx);
+    helpUi->textBrowser->clear();
+    helpUi->textBrowser->setText(html_start + body + html_end);
+
+    helpUi->stackedWidget->setCurrentIndex(idx > helpUi->stackedWidget->count() ? 0 : idx);
 
 }
 
@@ -1321,7 +1781,7 @@ void MainWindow::onPlusLRClicked()
     accumLR = units;
 
     currentFaderLR = accumLR / 10000.0f;
-    ui->dial_LR->setProperty("progress01", currentFaderLR);
+    ui->dial_LR->setProgress01(currentFaderLR);
 
 
     // move o dial sem emitir signals (0..999)
@@ -1335,7 +1795,7 @@ void MainWindow::onPlusLRClicked()
 
     // atualiza UI (label e barra)
     if (ui->labelPercent_LR){
-        ui->labelPercent_LR->setText(QString::number(currentFaderLR, 'f', 4));
+        ui->labelPercent_LR->setValue(currentFaderLR);
     }
     if (ui->pbarVol_LR){
         ui->pbarVol_LR->setValue(int(std::lround(currentFaderLR * 100.0f)));
@@ -1352,15 +1812,14 @@ void MainWindow::pbMuteHelpSlot()
     auto b = qobject_cast<QAbstractButton*>(sender());
     if (!b) { return;}
 
-    const bool checkedHELP = b->isChecked();
     //LOGICA PARA BOTAO DO MUTE NO HELP
-    if (ui->pbMuteHELP) {
-        ui->pbMuteHELP->setIcon(QIcon(checkedHELP ? QStringLiteral(":/icons/resources/unmuted.svg") : QStringLiteral(":/icons/resources/muted.svg")));
-
-    }
+    // ícone acompanha o checked (setStateIcons no setup; checked = aberto)
+    if (helpUi) helpUi->pbMuteHELP->update();
 }
 
 MainWindow::~MainWindow()
 {
+    delete helpUi;
+    delete logsUi;
     delete ui;
 }
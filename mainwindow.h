@@ -16,9 +16,12 @@
 #include <QGuiApplication>
 #include <QInputMethod>
 #include <QAbstractButton>
+#include <QElapsedTimer>
 #include <moderndial.h>
 #include <modernbutton.h>
 #include <modernprogressbar.h>
+#include <numericreadout.h>
+#include <logbuffer.h>
 
 #define NUMBER_OF_CHANNELS 8
 #define NUMBER_OF_SCENES   6
@@ -34,10 +37,19 @@ static QString profilesIniPath() {
 }
 
 QT_BEGIN_NAMESPACE
-namespace Ui { class MainWindow; }
+namespace Ui { class MainWindow; class HelpTab; class LogsTab; }
 QT_END_NAMESPACE
 
 class OscClient; // forward declaration
+class LogModel;
+class StatsPanel;
+class SceneStore;
+class SceneMorph;
+class ShowFile;
+class QComboBox;
+class OscProxy;
+class MixerSessions;
+class QHostAddress;
 
 class MainWindow : public QMainWindow {
     Q_OBJECT
@@ -46,6 +58,14 @@ public:
     explicit MainWindow(QWidget *parent = nullptr);
     ~MainWindow();
 
+    OscClient* oscClient() const { return osc; }
+
+    // Proxy: outros tablets usam esta sessão com o console (ver oscproxy.h)
+    bool setProxyEnabled(bool on, quint16 port = 10024);
+
+protected:
+    bool event(QEvent* e) override;
+
 public slots:
     void onDialValueChanged(int v);
     void onOscMeter(float val01);
@@ -69,30 +89,78 @@ private slots:
     // cenas / perfis
     void onSaveActiveSceneClicked();
     void onSceneClicked(QAbstractButton* b);
+    void onMorphFrame(const QVector<float>& v);
+    void onMorphFinished();
     //void onMakeProfile();  // você conecta isso no construtor
 
     // envio de fader com throttle
     void onDialPressed();
     void onDialReleased();
     void flushFaderSend(int idx);
+    void onLatencyChanged(int p95Ms);
 
     void onLRDialValueChanged(int v);
     void onLRDialPressed();
     void onLRDialReleased();
     void flushLRFaderSend();
     void onConnectButton();
+    void switchConsole(int index);
 
     void onHelpButtonsClicked();
+    void onTabActivated(int index);
+    void onExportLogs();
+    void onSaveShow();
+    void onOpenShow();
 
     void pbMuteHelpSlot();
 
+    void applyPendingRx();
+
 private:
     Ui::MainWindow *ui;
+    Ui::HelpTab    *helpUi = nullptr;   // montada na 1ª abertura da aba Ajuda
+    Ui::LogsTab    *logsUi = nullptr;   // montada na 1ª abertura da aba Logs
+
+    void setupHelpTab();
+    void setupLogsTab();
+    void setupConfigTab();
+
+    StatsPanel *statsPanel = nullptr;   // aba Config (métricas), montada na 1ª abertura
+
+    SceneStore *scenes = nullptr;       // profiles.ini em memória (cenas + labels)
+
+    // ---- cenas: crossfade de faders + mutes aplicados no fim ----
+    static constexpr int kSceneFadeDefaultMs = 1500;
+    SceneMorph *morph = nullptr;
+    QList<int>  morphMuteAtEnd;          // canais que mutam quando o fade termina
+    bool        morphMuteLRAtEnd = false;
+    QVector<bool> morphInScene;          // índice do frame que a cena move (fader/LR)
+    int  sceneFadeMs() const;
+    int  sceneSnapshotSlot(const QString& key) const;   // 0 = cena local
+
+    // cenas mapeadas em snapshots do console (aba Config)
+    static constexpr int kSnapshotResyncMs = 300;
+    QComboBox* snapCombos[NUMBER_OF_SCENES]{};
+    QPushButton* snapReadButton = nullptr;
+    void updateSnapshotUi();        // X32/M32 não têm /-snap: combos desabilitados
+    void applySceneMute(int ch, bool mute);
+    void applySceneMuteLR(bool mute);
+    int  applyShowParams(const ShowFile& show);
 
     // ===== OSC =====
-    OscClient* osc = nullptr;                 // cliente OSC (membro)
-
-    // throttle por canal
+    MixerSessions* sessions = nullptr;        // consoles simultâneos (um socket, um tick)
+    OscClient* osc = nullptr;                 // cliente da sessão ativa
+    QComboBox* consoleCombo = nullptr;        // aba Config
+    int  addConsole(const QString& spec);     // "Nome@ip[:porta]"
+    int  addConsole(const QString& name, const QHostAddress& addr, quint16 port);
+    void saveConsoles();                      // CONFIG/consoles (exceto a principal)
+    void startSession(OscClient* c);          // /xinfo, keepalive, meters, sync
+    OscProxy*  proxy = nullptr;               // criado no 1º setProxyEnabled(true)
+    QPushButton* proxyButton = nullptr;       // aba Config
+
+    // throttle por canal (intervalo adaptado ao RTT: onLatencyChanged)
+    static constexpr int kSendIntervalMinMs = 33;   // ~30 Hz
+    static constexpr int kSendIntervalMaxMs = 100;
     QTimer* sendTimers[NUMBER_OF_CHANNELS]{}; // timers singleShot (~30 Hz)
     bool    dragging[NUMBER_OF_CHANNELS]{};   // está arrastando este dial?
 
@@ -117,7 +185,7 @@ private:
     // QButtonGroup *labelChanGroup = nullptr;
 
     QButtonGroup *helpGroup = nullptr;
-    QPushButton *helpButtons[NUMBER_OF_HELPS];
+    QPushButton *helpButtons[NUMBER_OF_HELPS]{};
 
     QPushButton *titlesArray[NUMBER_OF_CHANNELS]{};
     ModernButton *pbTauArray[NUMBER_OF_SCENES]{};     // <- cenas (6)
@@ -125,25 +193,24 @@ private:
     ModernButton *pbPlus[NUMBER_OF_CHANNELS]{};
     ModernButton *pbMinus[NUMBER_OF_CHANNELS]{};
 
-    QLabel *labelsPercentArray[NUMBER_OF_CHANNELS]{};
+    NumericReadout *labelsPercentArray[NUMBER_OF_CHANNELS]{};
     ModernProgressBar *percBarsArray[NUMBER_OF_CHANNELS]{};
     QProgressBar*  meterBarsArray[NUMBER_OF_CHANNELS]{};
 
-    QStringList helpTexts;
-
-    QDial* dials[NUMBER_OF_CHANNELS]{};
+    ModernDial* dials[NUMBER_OF_CHANNELS]{};
     int   accumArr[NUMBER_OF_CHANNELS]{};            // 0..10000
     int   lastDialArr[NUMBER_OF_CHANNELS]{};         // 0..999
     float currentFaderArr[NUMBER_OF_CHANNELS]{};     // 0..1
 
     void loadChannelLabels();
-    void appendLog(const QString &msg,
-                   const QString &color = "white",
-                   bool bold = false,
-                   bool italic = false);
+    void appendLog(const QString &msg, LogBuffer::Level level = LogBuffer::Info);
 
     bool startedMsgs = false;
 
+    // aba Logs: modelo sobre o LogBuffer (criado no setupLogsTab)
+    LogModel* logModel = nullptr;
+    bool      logFollowTail = true;
+
     // ---- LR fader (estado próprio) ----
     int   lastDialLR = 0;
     int   accumLR    = 0;       // 0..10000
@@ -151,6 +218,30 @@ private:
     bool  draggingLR = false;
     QTimer* sendTimerLR = nullptr;
 
+    // ---- Estado recebido do mixer, aplicado na UI 1x por frame ----
+    // Rajadas (syncAll, outro operador mexendo) só sobrescrevem o buffer; último valor vence.
+    struct PendingRx {
+        float fader[NUMBER_OF_CHANNELS];   // < 0 = nada pendente
+        int   mute[NUMBER_OF_CHANNELS];    // -1 = nada pendente; 1 = on (unmuted)
+        float faderLR;
+        int   muteLR;
+        void clear() {
+            for (int i = 0; i < NUMBER_OF_CHANNELS; ++i) { fader[i] = -1.0f; mute[i] = -1; }
+            faderLR = -1.0f;
+            muteLR  = -1;
+        }
+    } pendingRx;
+    QTimer rxApplyTimer;
+    void schedulePendingRx();
+    void showChannelFader(int idx, float v01);
+    void showLRFader(float v01);
+
+    // ---- tempos de partida (setupUi / ligações / 1º paint), logados uma vez ----
+    QElapsedTimer startupTimer;
+    qint64 startupSetupUiMs = 0;
+    qint64 startupWiringMs  = 0;
+    bool   startupLogged    = false;
+
     QString html_start  = "<div style='text-align: justify;'>";
     QString html_end = "</div>";
 
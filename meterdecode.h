@@ -0,0 +1,64 @@
+#pragma once
+#include <QByteArray>
+#include <QtEndian>
+#include <cmath>
+#include <cstring>
+
+/*
+ * Decodificação dos blobs de meter (/meters/1, /meters/3)
+ * - Valores int16 big-endian em dB*256
+ * - Prefixo opcional u32 BE com o tamanho em bytes do restante (pulado
+ *   quando bate exatamente)
+ * - Escala da UI: -70 dB..0 dB -> 0..100 %
+ * Header-only: usado pelo handler de RX e pelos benchmarks.
+ */
+
+static constexpr float kMeterFloorDb = -70.0f;
+
+// Offset do 1º valor no blob (0 ou 4)
+inline int meterBlobOffset(const QByteArray& raw)
+{
+    if (raw.size() < 6) return 0;
+    quint32 beLen;
+    std::memcpy(&beLen, raw.constData(), 4);
+    const quint32 declared = qFromBigEndian(beLen);
+    const int remaining = raw.size() - 4;
+    return (declared > 0 && int(declared) == remaining) ? 4 : 0;
+}
+
+inline int meterDbToPct(float dB)
+{
+    if (dB <= kMeterFloorDb) return 0;
+    if (dB >= 0.0f)          return 100;
+    return int(std::lround((dB - kMeterFloorDb) / (0.0f - kMeterFloorDb) * 100.0f));
+}
+
+// Preenche out[0..n) em % (valores ausentes = 0); devolve quantos valores o blob tem
+inline int meterBlobToPercent(const QByteArray& raw, int* out, int n)
+{
+    const int offset  = meterBlobOffset(raw);
+    const int nShorts = (raw.size() - offset) / 2;
+    const char* p = raw.constData() + offset;
+
+    for (int i = 0; i < n; ++i) {
+        if (i >= nShorts) { out[i] = 0; continue; }
+        quint16 be; std::memcpy(&be, p + i * 2, 2);
+        const qint16 s = qint16(qFromBigEndian(be));
+        out[i] = meterDbToPct(s / 256.0f);
+    }
+    return nShorts;
+}
+
+// Valores crus (dB*256, ordem do host) em out[0..n); devolve quantos foram copiados
+inline int meterBlobToDb256(const QByteArray& raw, qint16* out, int n)
+{
+    const int offset  = meterBlobOffset(raw);
+    const int nShorts = qMin((raw.size() - offset) / 2, n);
+    const char* p = raw.constData() + offset;
+
+    for (int i = 0; i < nShorts; ++i) {
+        quint16 be; std::memcpy(&be, p + i * 2, 2);
+        out[i] = qint16(qFromBigEndian(be));
+    }
+    return qMax(0, nShorts);
+}
@@ -0,0 +1,159 @@
+#include "metrics.h"
+#include <QMutex>
+#include <QMutexLocker>
+#include <QJsonArray>
+#include <QElapsedTimer>
+#include <QtAlgorithms>
+
+// ====== Registro de shards (mutex só na 1ª métrica de cada thread) ======
+// Shards não são liberados ao fim da thread: o app tem poucas threads e os
+// totais continuam válidos no snapshot.
+QMutex& Metrics::registryMutex() { static QMutex m; return m; }
+QVector<Metrics::Shard*>& Metrics::registry() { static QVector<Shard*> v; return v; }
+
+Metrics::Shard* Metrics::registerShard()
+{
+    auto* s = new Shard;
+    QMutexLocker lock(&registryMutex());
+    registry().append(s);
+    return s;
+}
+
+Metrics::Shard& Metrics::shard()
+{
+    static thread_local Shard* s = registerShard();
+    return *s;
+}
+
+// ====== Faixas: 0..3 lineares, depois 4 sub-faixas por potência de 2 ======
+int Metrics::bucketOf(quint32 v)
+{
+    if (v < 4) return int(v);
+    const int msb = 31 - qCountLeadingZeroBits(v);   // 2..31
+    const int sub = int((v >> (msb - 2)) & 3u);
+    return 4 + (msb - 2) * 4 + sub;                  // 4..123
+}
+
+quint32 Metrics::bucketUpper(int b)
+{
+    if (b < 4) return quint32(b);
+    if (b >= kBuckets - 1) return 0xFFFFFFFFu;
+    const int msb = (b - 4) / 4 + 2;
+    const int sub = (b - 4) % 4;
+    const quint64 lo = quint64(4 + sub) << (msb - 2);
+    return quint32(lo + (quint64(1) << (msb - 2)) - 1);
+}
+
+// ====== Snapshot ======
+Metrics::Snapshot Metrics::snapshot()
+{
+    static QElapsedTimer clock;
+    if (!clock.isValid()) clock.start();
+
+    Snapshot out;
+    out.msecs = clock.elapsed();
+
+    QMutexLocker lock(&registryMutex());
+    for (const Shard* s : registry()) {
+        for (int c = 0; c < CounterCount; ++c)
+            out.counters[c] += s->counters[c].load(std::memory_order_relaxed);
+        for (int h = 0; h < HistogramCount; ++h)
+            for (int b = 0; b < kBuckets; ++b)
+                out.hist[h][b] += s->hist[h][b].load(std::memory_order_relaxed);
+    }
+    return out;
+}
+
+Metrics::Snapshot Metrics::Snapshot::since(const Snapshot& older) const
+{
+    Snapshot d;
+    d.msecs = msecs - older.msecs;
+    for (int c = 0; c < CounterCount; ++c)
+        d.counters[c] = counters[c] - older.counters[c];
+    for (int h = 0; h < HistogramCount; ++h)
+        for (int b = 0; b < kBuckets; ++b)
+            d.hist[h][b] = hist[h][b] - older.hist[h][b];
+    return d;
+}
+
+quint64 Metrics::Snapshot::count(Histogram h) const
+{
+    quint64 n = 0;
+    for (int b = 0; b < kBuckets; ++b) n += hist[h][b];
+    return n;
+}
+
+quint32 Metrics::Snapshot::percentile(Histogram h, double p) const
+{
+    const quint64 n = count(h);
+    if (n == 0) return 0;
+    const quint64 rank = qMax<quint64>(1, quint64(p * double(n) + 0.5));
+    quint64 acc = 0;
+    for (int b = 0; b < kBuckets; ++b) {
+        acc += hist[h][b];
+        if (acc >= rank) return bucketUpper(b);
+    }
+    return bucketUpper(kBuckets - 1);
+}
+
+// ====== Nomes / JSON ======
+const char* Metrics::counterName(Counter c)
+{
+    switch (c) {
+    case DatagramsIn:   return "datagramsIn";
+    case BytesIn:       return "bytesIn";
+    case DatagramsOut:  return "datagramsOut";
+    case BytesOut:      return "bytesOut";
+    case SendFailures:  return "sendFailures";
+    case MeterFramesCh: return "meterFramesCh";
+    case MeterFramesLR: return "meterFramesLR";
+    case Malformed:     return "malformed";
+    case Dropped:       return "dropped";
+    case UiFrames:      return "uiFrames";
+    case RttSamples:    return "rttSamples";
+    case RttLost:       return "rttLost";
+    case CounterCount:  break;
+    }
+    return "?";
+}
+
+const char* Metrics::histogramName(Histogram h)
+{
+    switch (h) {
+    case ParseUs:        return "parseUs";
+    case UiFrameUs:      return "uiFrameUs";
+    case TimerLateUs:    return "timerLateUs";
+    case RttUs:          return "rttUs";
+    case HistogramCount: break;
+    }
+    return "?";
+}
+
+QJsonObject Metrics::toJson(const Snapshot& s)
+{
+    QJsonObject counters;
+    for (int c = 0; c < CounterCount; ++c)
+        counters.insert(QLatin1String(counterName(Counter(c))), double(s.counters[c]));
+
+    QJsonObject hists;
+    for (int h = 0; h < HistogramCount; ++h) {
+        const Histogram hh = Histogram(h);
+        QJsonArray buckets;   // [limite superior em µs, contagem], só faixas não vazias
+        for (int b = 0; b < kBuckets; ++b)
+            if (s.hist[h][b]) buckets.append(QJsonArray{ double(bucketUpper(b)), double(s.hist[h][b]) });
+
+        QJsonObject o;
+        o.insert("count", double(s.count(hh)));
+        o.insert("p50",   double(s.percentile(hh, 0.50)));
+        o.insert("p95",   double(s.percentile(hh, 0.95)));
+        o.insert("p99",   double(s.percentile(hh, 0.99)));
+        o.insert("buckets", buckets);
+        hists.insert(QLatin1String(histogramName(hh)), o);
+    }
+
+    QJsonObject root;
+    root.insert("uptimeMs", double(s.msecs));
+    root.insert("counters", counters);
+    root.insert("histograms", hists);
+    return root;
+}
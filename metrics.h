@@ -0,0 +1,85 @@
+#pragma once
+#include <QtGlobal>
+#include <QJsonObject>
+#include <QVector>
+#include <atomic>
+
+class QMutex;
+
+/*
+ * Metrics — contadores e histogramas baratos para o caminho quente
+ * - Um "shard" por thread (thread_local): a escrita é load+store relaxed,
+ *   sem lock e sem disputa de cache entre threads
+ * - Leitura (snapshot) soma os shards; taxas por segundo e percentis de
+ *   janela saem da diferença entre dois snapshots (Snapshot::since)
+ * - Histogramas log-lineares (4 sub-faixas por potência de 2), em µs
+ * - toJson(): despejo para diagnóstico em campo
+ */
+
+class Metrics
+{
+public:
+    enum Counter {
+        DatagramsIn = 0,
+        BytesIn,
+        DatagramsOut,
+        BytesOut,
+        SendFailures,
+        MeterFramesCh,     // /meters/1
+        MeterFramesLR,     // /meters/3
+        Malformed,         // datagrama/elemento de bundle truncado ou sem endereço
+        Dropped,           // blob de meter inválido, leitura de socket falha
+        UiFrames,
+        RttSamples,        // sets com resposta (eco/GET) medida
+        RttLost,           // sets sem resposta dentro do timeout
+        CounterCount
+    };
+
+    enum Histogram {
+        ParseUs = 0,       // parseDatagram por datagrama
+        UiFrameUs,         // processamento de um UpdateRequest (paint + flush)
+        TimerLateUs,       // atraso do timer de meters em relação ao intervalo
+        RttUs,             // ida e volta set -> eco/resposta do mixer
+        HistogramCount
+    };
+
+    static constexpr int kBuckets = 124;
+
+    struct Snapshot {
+        quint64 counters[CounterCount]{};
+        quint64 hist[HistogramCount][kBuckets]{};
+        qint64  msecs = 0;                       // relógio monotônico da coleta
+
+        Snapshot since(const Snapshot& older) const;   // diferença (janela)
+        quint64 count(Histogram h) const;
+        quint32 percentile(Histogram h, double p) const; // µs (limite superior da faixa)
+    };
+
+    static inline void add(Counter c, quint64 n = 1) {
+        auto& a = shard().counters[c];
+        a.store(a.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+    static inline void record(Histogram h, quint32 value) {
+        auto& a = shard().hist[h][bucketOf(value)];
+        a.store(a.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    static Snapshot snapshot();
+    static QJsonObject toJson(const Snapshot& s);
+
+    static const char* counterName(Counter c);
+    static const char* histogramName(Histogram h);
+
+    static int     bucketOf(quint32 v);
+    static quint32 bucketUpper(int b);
+
+private:
+    struct Shard {
+        std::atomic<quint64> counters[CounterCount]{};
+        std::atomic<quint64> hist[HistogramCount][kBuckets]{};
+    };
+    static Shard& shard();
+    static Shard* registerShard();
+    static QMutex& registryMutex();
+    static QVector<Shard*>& registry();
+};
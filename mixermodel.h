@@ -0,0 +1,245 @@
+#pragma once
+#include <QByteArray>
+#include <QString>
+#include <QVariantList>
+#include <QtEndian>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "meterdecode.h"
+
+/*
+ * Perfis de modelo (X-Air / X32) — o que muda de um console para outro
+ * - MixerCaps: tabela constexpr por modelo (canais, buses, DCAs, porta OSC,
+ *   formato e bancos de meter, prefixo do LR, slots de /-snap)
+ * - MixerCodec<M>: encoders/decoders especializados em tempo de compilação;
+ *   tamanhos e limites são constantes do modelo, nada é deduzido do blob
+ * - MixerProfile: ponteiros para o codec do modelo, escolhidos uma vez quando
+ *   o /xinfo identifica o console (OscClient::setModel)
+ * - RX do X32/M32 ("/main/st/...") sai com o endereço da app ("/lr/...");
+ *   meters saem sempre como "/meters/1" (canais) e "/meters/3" (LR)
+ * - Meters: X-Air = int16 BE em dB*256 (prefixo de tamanho opcional, como o
+ *   app e o emulador sempre usaram); X32/M32 = nº de floats (int32 LE) +
+ *   floats LE lineares (1.0 = 0 dBFS). LR do X32 vem no /meters/2 (bus 16,
+ *   matrix 6, L, R, ...): banco { 22, 2 }
+ * Unknown = limites de antes da detecção (32 canais, banco mínimo de 16 valores).
+ * Header-only: usado pelo OscClient, pela UI e pelos benchmarks.
+ */
+
+enum class MixerModel : quint8 { Unknown, XR12, XR16, XR18, X32, M32 };
+enum class MixerFamily : quint8 { XAir, X32 };
+enum class MeterFormat : quint8 { Db256BE, FloatLE };
+
+static constexpr quint16 kXAirPort         = 10024;
+static constexpr quint16 kX32Port          = 10023;
+static constexpr int     kMixerMaxChannels = 32;
+
+// Banco de meter: `count` valores int16 (dB*256) a partir do índice `first`
+struct MeterBank { int first; int count; };
+
+struct MixerCaps {
+    MixerModel  model;
+    MixerFamily family;
+    const char* name;          // como vem no /xinfo
+    quint16     port;          // porta OSC do console
+    int         channels;
+    int         buses;
+    int         dcas;
+    MeterFormat meterFormat;
+    const char* meterChAddr;   // banco dos canais (assinatura e RX)
+    MeterBank   meterCh;       // canal 1 em first
+    const char* meterLRAddr;   // banco do LR
+    MeterBank   meterLR;       // L, R
+    const char* lrPrefix;      // "/lr" ou "/main/st"
+    int         snapshots;     // slots de /-snap (X-Air); 0 = sem snapshots por OSC
+};
+
+inline constexpr MixerCaps kMixerCaps[] = {
+    // modelo              família              nome    porta      ch bus dca  formato dos meters    banco dos canais       banco do LR             prefixo LR  snaps
+    { MixerModel::Unknown, MixerFamily::XAir, "?",    kXAirPort, 32,  6, 4, MeterFormat::Db256BE, "/meters/1", { 0, 16 }, "/meters/3", {  0, 2 }, "/lr",       64 },
+    { MixerModel::XR12,    MixerFamily::XAir, "XR12", kXAirPort, 12,  4, 4, MeterFormat::Db256BE, "/meters/1", { 0, 12 }, "/meters/3", {  0, 2 }, "/lr",       64 },
+    { MixerModel::XR16,    MixerFamily::XAir, "XR16", kXAirPort, 16,  4, 4, MeterFormat::Db256BE, "/meters/1", { 0, 16 }, "/meters/3", {  0, 2 }, "/lr",       64 },
+    { MixerModel::XR18,    MixerFamily::XAir, "XR18", kXAirPort, 16,  6, 4, MeterFormat::Db256BE, "/meters/1", { 0, 16 }, "/meters/3", {  0, 2 }, "/lr",       64 },
+    { MixerModel::X32,     MixerFamily::X32,  "X32",  kX32Port,  32, 16, 8, MeterFormat::FloatLE, "/meters/1", { 0, 32 }, "/meters/2", { 22, 2 }, "/main/st",   0 },
+    { MixerModel::M32,     MixerFamily::X32,  "M32",  kX32Port,  32, 16, 8, MeterFormat::FloatLE, "/meters/1", { 0, 32 }, "/meters/2", { 22, 2 }, "/main/st",   0 },
+};
+
+constexpr const MixerCaps& mixerCaps(MixerModel m) { return kMixerCaps[int(m)]; }
+
+static_assert(mixerCaps(MixerModel::M32).model == MixerModel::M32, "kMixerCaps na ordem do enum");
+static_assert(mixerCaps(MixerModel::Unknown).channels == kMixerMaxChannels, "Unknown cobre todos os canais");
+
+// /xinfo = ip, nome, modelo, firmware; variantes (X32RACK, X18, M32R...) caem no modelo base
+inline MixerModel mixerModelFromXinfo(const QVariantList& args)
+{
+    const QString m = args.value(2).toString().trimmed().toUpper();
+    if (m.startsWith(QLatin1String("XR12")))                    return MixerModel::XR12;
+    if (m.startsWith(QLatin1String("XR16")))                    return MixerModel::XR16;
+    if (m.startsWith(QLatin1String("XR18")) || m == QLatin1String("X18")) return MixerModel::XR18;
+    if (m.startsWith(QLatin1String("X32")))                     return MixerModel::X32;
+    if (m.startsWith(QLatin1String("M32")))                     return MixerModel::M32;
+    return MixerModel::Unknown;
+}
+
+// Endereços do modelo já codificados (endereço + ",f"/",i"): set = cabeçalho + 4 bytes
+struct MixerAddresses {
+    QString    faderPath[kMixerMaxChannels];   // índice 0 = canal 1
+    QString    onPath[kMixerMaxChannels];
+    QByteArray faderHead[kMixerMaxChannels];
+    QByteArray onHead[kMixerMaxChannels];
+    QString    lrFaderPath, lrOnPath;
+    QByteArray lrFaderHead, lrOnHead;
+};
+
+// ====== Codec por modelo ======
+template <MixerModel M>
+struct MixerCodec
+{
+    static constexpr MixerCaps kCaps    = mixerCaps(M);
+    static constexpr bool      kFloat   = kCaps.meterFormat == MeterFormat::FloatLE;
+    static constexpr int       kValue   = kFloat ? 4 : 2;          // bytes por valor
+    static constexpr int       kChBytes = (kCaps.meterCh.first + kCaps.meterCh.count) * kValue;
+    static constexpr int       kLRBytes = (kCaps.meterLR.first + kCaps.meterLR.count) * kValue;
+    static_assert(kCaps.channels <= kMixerMaxChannels, "MixerAddresses comporta kMixerMaxChannels");
+
+    // o blob traz o banco inteiro?
+    static bool acceptChannelMeters(const QByteArray& b) { return accept(b, kChBytes); }
+    static bool acceptLRMeters(const QByteArray& b)      { return accept(b, kLRBytes); }
+
+    // % em out[0..n) (além do banco = 0); só depois do accept*: sem checagem por valor
+    static void channelMeters(const QByteArray& b, int* out, int n)
+    {
+        const char* p = b.constData() + offset(b) + kCaps.meterCh.first * kValue;
+        const int m = std::min(n, kCaps.meterCh.count);
+        for (int i = 0; i < m; ++i) out[i] = meterDbToPct(db(p, i));
+        for (int i = m; i < n; ++i) out[i] = 0;
+    }
+    static void lrMeters(const QByteArray& b, int* out)
+    {
+        const char* p = b.constData() + offset(b) + kCaps.meterLR.first * kValue;
+        for (int i = 0; i < 2; ++i) out[i] = meterDbToPct(db(p, i));
+    }
+
+    // dB*256 (layout do osccb_shm.h): o blob de canais inteiro / o par do LR
+    static int allMetersDb256(const QByteArray& b, qint16* out, int n)
+    {
+        const int off = offset(b);
+        const int m = std::min(n, std::max(0, (int(b.size()) - off) / kValue));
+        for (int i = 0; i < m; ++i) out[i] = db256(db(b.constData() + off, i));
+        return m;
+    }
+    static void lrMetersDb256(const QByteArray& b, qint16* out)
+    {
+        const char* p = b.constData() + offset(b) + kCaps.meterLR.first * kValue;
+        for (int i = 0; i < 2; ++i) out[i] = db256(db(p, i));
+    }
+
+    // RX: endereço do console -> endereço da app
+    static void canonical(QString& address)
+    {
+        if constexpr (kCaps.family == MixerFamily::X32) {
+            if (address.startsWith(QLatin1String("/main/st/"))) address.replace(0, 8, QStringLiteral("/lr"));
+        } else {
+            Q_UNUSED(address)
+        }
+    }
+
+    static const MixerAddresses& addresses()
+    {
+        static const MixerAddresses a = [] {
+            MixerAddresses t;
+            for (int ch = 1; ch <= kCaps.channels; ++ch) {
+                const QString nn = QStringLiteral("%1").arg(ch, 2, 10, QChar('0'));
+                t.faderPath[ch - 1] = QStringLiteral("/ch/%1/mix/fader").arg(nn);
+                t.onPath[ch - 1]    = QStringLiteral("/ch/%1/mix/on").arg(nn);
+                t.faderHead[ch - 1] = head(t.faderPath[ch - 1], ",f");
+                t.onHead[ch - 1]    = head(t.onPath[ch - 1], ",i");
+            }
+            t.lrFaderPath = QLatin1String(kCaps.lrPrefix) + QStringLiteral("/mix/fader");
+            t.lrOnPath    = QLatin1String(kCaps.lrPrefix) + QStringLiteral("/mix/on");
+            t.lrFaderHead = head(t.lrFaderPath, ",f");
+            t.lrOnHead    = head(t.lrOnPath, ",i");
+            return t;
+        }();
+        return a;
+    }
+
+private:
+    // X32: int32 LE com o nº de floats, que tem de bater com o blob
+    static bool accept(const QByteArray& b, int bytes)
+    {
+        if constexpr (kFloat) {
+            if (b.size() < 4 || (b.size() % 4) != 0) return false;
+            qint32 n; std::memcpy(&n, b.constData(), 4);
+            n = qFromLittleEndian(n);
+            return qint64(n) * 4 == b.size() - 4 && b.size() - 4 >= bytes;
+        } else {
+            return (b.size() % 2) == 0 && b.size() - meterBlobOffset(b) >= bytes;
+        }
+    }
+    static int offset(const QByteArray& b) { return kFloat ? 4 : meterBlobOffset(b); }
+
+    // valor i a partir de p, em dB
+    static float db(const char* p, int i)
+    {
+        if constexpr (kFloat) {
+            quint32 le; std::memcpy(&le, p + i * 4, 4);
+            le = qFromLittleEndian(le);
+            float v; std::memcpy(&v, &le, 4);
+            return v > 0.0f ? 20.0f * std::log10(v) : kMeterFloorDb;
+        } else {
+            quint16 be; std::memcpy(&be, p + i * 2, 2);
+            return qint16(qFromBigEndian(be)) / 256.0f;
+        }
+    }
+    static qint16 db256(float dB)
+    {
+        return qint16(qBound(-32768L, std::lround(dB * 256.0f), 32767L));
+    }
+
+    // string OSC: '\0' + padding até múltiplo de 4
+    static QByteArray head(const QString& path, const char* tags)
+    {
+        QByteArray h;
+        for (QByteArray s : { path.toUtf8(), QByteArray(tags) }) {
+            s.append('\0');
+            while (s.size() % 4) s.append('\0');
+            h += s;
+        }
+        return h;
+    }
+};
+
+// ====== Perfil em uso (escolhido uma vez por console) ======
+struct MixerProfile {
+    const MixerCaps* caps;
+    const MixerAddresses& (*addresses)();
+    bool (*acceptChannelMeters)(const QByteArray&);
+    bool (*acceptLRMeters)(const QByteArray&);
+    void (*channelMeters)(const QByteArray&, int* out, int n);
+    void (*lrMeters)(const QByteArray&, int* out);
+    int  (*allMetersDb256)(const QByteArray&, qint16* out, int n);
+    void (*lrMetersDb256)(const QByteArray&, qint16* out);
+    void (*canonical)(QString& address);
+};
+
+template <MixerModel M>
+constexpr MixerProfile makeMixerProfile()
+{
+    using C = MixerCodec<M>;
+    return { &mixerCaps(M), &C::addresses, &C::acceptChannelMeters, &C::acceptLRMeters,
+             &C::channelMeters, &C::lrMeters, &C::allMetersDb256, &C::lrMetersDb256, &C::canonical };
+}
+
+inline const MixerProfile& mixerProfile(MixerModel m)
+{
+    static constexpr MixerProfile table[] = {
+        makeMixerProfile<MixerModel::Unknown>(),
+        makeMixerProfile<MixerModel::XR12>(),
+        makeMixerProfile<MixerModel::XR16>(),
+        makeMixerProfile<MixerModel::XR18>(),
+        makeMixerProfile<MixerModel::X32>(),
+        makeMixerProfile<MixerModel::M32>(),
+    };
+    return table[int(m)];
+}
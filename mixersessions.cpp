@@ -0,0 +1,123 @@
+#include "mixersessions.h"
+#include "oscclient.h"
+#include "logbuffer.h"
+#include "metrics.h"
+#include "trace.h"
+
+MixerSessions::MixerSessions(QObject* parent)
+    : QObject(parent)
+{
+    connect(&m_sock, &QUdpSocket::readyRead, this, &MixerSessions::onReadyRead);
+    m_tick.setInterval(kTickMs);
+    connect(&m_tick, &QTimer::timeout, this, &MixerSessions::tick);
+}
+
+MixerSessions::~MixerSessions()
+{
+    // clientes antes do socket compartilhado (membro) que eles usam
+    for (Session* s : std::as_const(m_sessions)) { delete s->osc; delete s; }
+}
+
+bool MixerSessions::open(quint16 localPort)
+{
+    if (isOpen()) return true;
+    if (!m_sock.bind(QHostAddress::AnyIPv4, localPort, QUdpSocket::ShareAddress)) {
+        logError("osc", QString("bind falhou na porta %1: %2").arg(localPort).arg(m_sock.errorString()));
+        return false;
+    }
+    m_tick.start();
+    return true;
+}
+
+// ============ Sessões ============
+int MixerSessions::add(const QString& name, const QHostAddress& addr, quint16 port)
+{
+    auto* s = new Session;
+    s->name = name;
+    s->osc  = new OscClient(this);
+    s->osc->attachShared(&m_sock);
+    if (!addr.isNull()) s->osc->setTarget(addr, port);
+
+    // estado de todas as sessões; sinais só da ativa
+    connect(s->osc, &OscClient::oscMessageReceived, this, [this, s](const QString& address, const QVariantList& args) {
+        track(s->state, address, args);
+        if (isActive(s)) emit oscMessageReceived(address, args);
+    });
+    connect(s->osc, &OscClient::latencyChanged, this, [this, s](int p95Ms) {
+        if (isActive(s)) emit latencyChanged(p95Ms);
+    });
+    connect(s->osc, &OscClient::snapshotName, this, [this, s](int slot, const QString& n) {
+        if (isActive(s)) emit snapshotName(slot, n);
+    });
+
+    m_sessions.append(s);
+    logInfo("osc", QString("Sessão %1: %2").arg(name, addr.isNull() ? QStringLiteral("(descoberta)") : addr.toString()));
+    return int(m_sessions.size()) - 1;
+}
+
+void MixerSessions::remove(int index)
+{
+    if (index <= 0 || index >= count()) return;
+    Session* s = m_sessions.takeAt(index);
+    if (m_active == index) m_active = 0;
+    else if (m_active > index) --m_active;
+    s->osc->close();
+    delete s->osc;
+    delete s;
+}
+
+void MixerSessions::setActive(int index)
+{
+    if (index < 0 || index >= count()) return;
+    m_active = index;
+}
+
+// ============ RX compartilhado ============
+MixerSessions::Session* MixerSessions::route(const QHostAddress& from, quint16 port) const
+{
+    Session* sameHost = nullptr;
+    for (Session* s : m_sessions) {
+        if (!s->osc->targetAddress().isEqual(from, QHostAddress::ConvertV4MappedToIPv4)) continue;
+        if (s->osc->targetPort() == port) return s;
+        if (!sameHost) sameHost = s;     // resposta de outra porta do mesmo mixer
+    }
+    return sameHost;
+}
+
+void MixerSessions::onReadyRead()
+{
+    TRACE_SCOPE("sessions.onReadyRead");
+    while (m_sock.hasPendingDatagrams()) {
+        QByteArray d;
+        d.resize(int(m_sock.pendingDatagramSize()));
+        QHostAddress from; quint16 port = 0;
+        const qint64 n = m_sock.readDatagram(d.data(), d.size(), &from, &port);
+        Session* s = n < 0 ? nullptr : route(from, port);
+        if (!s || s->osc->isReplaying()) { Metrics::add(Metrics::Dropped); continue; }
+        d.resize(int(n));
+        s->osc->ingest(d);
+    }
+}
+
+void MixerSessions::tick()
+{
+    for (Session* s : std::as_const(m_sessions)) s->osc->pump();
+}
+
+// ============ Estado por sessão ============
+void MixerSessions::track(State& st, const QString& addr, const QVariantList& args)
+{
+    if (args.isEmpty()) return;
+
+    if (addr == QLatin1String("/meters/1")) { st.meters1 = args.first().toByteArray(); return; }
+    if (addr == QLatin1String("/meters/3")) { st.meters3 = args.first().toByteArray(); return; }
+    if (addr == QLatin1String("/lr/mix/fader")) { st.faderLR = qBound(0.0f, args.first().toFloat(), 1.0f); return; }
+    if (addr == QLatin1String("/lr/mix/on"))    { st.muteLR  = args.first().toInt() != 0 ? 1 : 0; return; }
+
+    if (!addr.startsWith(QLatin1String("/ch/"))) return;
+    bool ok = false;
+    const int idx = addr.mid(4, 2).toInt(&ok) - 1;
+    if (!ok || idx < 0 || idx >= kMaxChannels) return;
+    if (addr.endsWith(QLatin1String("/mix/fader")))   st.fader[idx] = qBound(0.0f, args.first().toFloat(), 1.0f);
+    else if (addr.endsWith(QLatin1String("/mix/on"))) st.mute[idx]  = args.first().toInt() != 0 ? 1 : 0;
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include <QObject>
+#include <QUdpSocket>
+#include <QHostAddress>
+#include <QTimer>
+#include <QList>
+#include <QVariantList>
+#include "rtttracker.h"
+#include "mixermodel.h"
+
+class OscClient;
+
+/*
+ * MixerSessions — vários consoles ao mesmo tempo (ex.: X32 da nave + X-Air da sala)
+ * - Um socket UDP para todas as sessões: o RX é roteado pelo remetente
+ *   (IP:porta do mixer) para o ingest() do OscClient da sessão; o TX sai
+ *   pelo mesmo socket (OscClient::attachShared)
+ * - Um tick só agenda keepalive, renovação de /meters e RTT de todas as
+ *   sessões (OscClient::pump): nenhum console a mais cria timer
+ * - Cada sessão guarda o último estado do console (State); trocar o console
+ *   da UI não pergunta nada ao mixer, só reaplica o que já está aqui
+ * - Sinais da sessão ativa são repassados: a UI liga uma vez e segue a troca
+ * Custo de um console a mais = o tráfego dele; repaint e timers da UI são os mesmos.
+ */
+
+class MixerSessions : public QObject
+{
+    Q_OBJECT
+public:
+    static constexpr int kTickMs      = RttTracker::kProbeIntervalMs;
+    static constexpr int kMaxChannels = kMixerMaxChannels;
+
+    // Último estado conhecido do console (RX da sessão + o que a UI deixou ao sair)
+    struct State {
+        float      fader[kMaxChannels];   // < 0 = desconhecido
+        int        mute[kMaxChannels];    // -1 = desconhecido; 1 = on (aberto)
+        float      faderLR = -1.0f;
+        int        muteLR  = -1;
+        QByteArray meters1;               // último blob de /meters/1 e /meters/3
+        QByteArray meters3;               // (decodificado só na troca)
+        State() {
+            for (int i = 0; i < kMaxChannels; ++i) { fader[i] = -1.0f; mute[i] = -1; }
+        }
+    };
+
+    explicit MixerSessions(QObject* parent = nullptr);
+    ~MixerSessions();
+
+    bool open(quint16 localPort);
+    bool isOpen() const { return m_sock.state() == QAbstractSocket::BoundState; }
+
+    int  add(const QString& name, const QHostAddress& addr = QHostAddress(), quint16 port = kXAirPort);
+    void remove(int index);               // a sessão 0 (principal) não sai
+    int  count() const { return int(m_sessions.size()); }
+
+    OscClient* client(int index) const { return m_sessions.at(index)->osc; }
+    QString    name(int index)   const { return m_sessions.at(index)->name; }
+    State&     state(int index)        { return m_sessions.at(index)->state; }
+
+    int        activeIndex() const { return m_active; }
+    OscClient* active()      const { return client(m_active); }
+    void       setActive(int index);
+
+signals:
+    // repasse da sessão ativa
+    void oscMessageReceived(QString address, QVariantList args);
+    void latencyChanged(int p95Ms);
+    void snapshotName(int slot, QString name);
+
+private slots:
+    void onReadyRead();
+    void tick();
+
+private:
+    struct Session {
+        QString    name;
+        OscClient* osc = nullptr;
+        State      state;
+    };
+
+    QUdpSocket      m_sock;
+    QTimer          m_tick;
+    QList<Session*> m_sessions;
+    int             m_active = 0;
+
+    bool isActive(const Session* s) const { return m_sessions.value(m_active) == s; }
+    Session* route(const QHostAddress& from, quint16 port) const;
+    static void track(State& st, const QString& addr, const QVariantList& args);
+};
@@ -4,6 +4,8 @@
 #include <QFontMetrics>
 #include <QApplication>
 #include <QMouseEvent>
+#include <QIcon>
+#include <QHash>
 #if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
 #include <QEnterEvent>
 #endif
@@ -29,6 +31,49 @@ void ModernButton::setIconSizePx(int px)
     update();
 }
 
+// ======== ícones por estado (cache compartilhado) ========
+QSharedPointer<const QPixmap> ModernButton::rasterizedIcon(const QString& path, int px, qreal dpr)
+{
+    if (path.isEmpty() || px <= 0) return {};
+
+    // Vive até o fim do app: poucos ícones × poucos tamanhos/DPRs
+    static QHash<QString, QSharedPointer<const QPixmap>> s_cache;
+
+    const QString key = QStringLiteral("%1@%2x%3").arg(path).arg(px).arg(dpr);
+    auto it = s_cache.constFind(key);
+    if (it != s_cache.constEnd()) return it.value();
+
+    // Único ponto que passa pelo engine de SVG / resource system
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+    QPixmap pm = QIcon(path).pixmap(QSize(px, px), dpr);
+#else
+    QPixmap pm = QIcon(path).pixmap(QSize(px, px) * dpr);
+    pm.setDevicePixelRatio(dpr);
+#endif
+    auto shared = QSharedPointer<const QPixmap>::create(pm);
+    s_cache.insert(key, shared);
+    return shared;
+}
+
+void ModernButton::setStateIcons(const QString& uncheckedPath, const QString& checkedPath)
+{
+    m_iconPathOff = uncheckedPath;
+    m_iconPathOn  = checkedPath;
+    m_pmPx = -1; // força resolver no próximo paint
+    update();
+}
+
+void ModernButton::resolveStateIcons()
+{
+    const qreal dpr = devicePixelRatioF();
+    if (m_pmPx == m_iconPx && qFuzzyCompare(m_pmDpr, dpr)) return;
+
+    m_pmPx  = m_iconPx;
+    m_pmDpr = dpr;
+    m_pmOff = rasterizedIcon(m_iconPathOff, m_iconPx, dpr);
+    m_pmOn  = rasterizedIcon(m_iconPathOn,  m_iconPx, dpr);
+}
+
 void ModernButton::paintEvent(QPaintEvent* e)
 {
     Q_UNUSED(e);
@@ -70,7 +115,15 @@ void ModernButton::paintEvent(QPaintEvent* e)
 #endif
     const int textH = fm.height();
 
-    const bool hasIcon = !icon().isNull() && m_iconPx > 0;
+    // Ícone por estado (ponteiro p/ pixmap já rasterizado) ou QIcon comum
+    const QPixmap* statePm = nullptr;
+    if (hasStateIcons()) {
+        resolveStateIcons();
+        const auto& sp = (isCheckable() && isChecked()) ? m_pmOn : m_pmOff;
+        if (sp && !sp->isNull()) statePm = sp.data();
+    }
+
+    const bool hasIcon = (statePm || !icon().isNull()) && m_iconPx > 0;
     const int  iconW   = hasIcon ? m_iconPx : 0;
     const int  iconH   = hasIcon ? m_iconPx : 0;
 
@@ -87,9 +140,9 @@ void ModernButton::paintEvent(QPaintEvent* e)
 
     // Ícone
     if (hasIcon) {
-        QPixmap pm = icon().pixmap(m_iconPx, m_iconPx);
         const int iy = cy + (baseH - iconH)/2;
-        p.drawPixmap(QPoint(x, iy), pm);
+        if (statePm) p.drawPixmap(QPoint(x, iy), *statePm);
+        else         p.drawPixmap(QPoint(x, iy), icon().pixmap(m_iconPx, m_iconPx));
         x += iconW;
         if (!t.isEmpty()) x += m_spacing;
     }
@@ -1,6 +1,8 @@
 #pragma once
 #include <QPushButton>
 #include <QColor>
+#include <QPixmap>
+#include <QSharedPointer>
 
 class ModernButton : public QPushButton
 {
@@ -20,6 +22,10 @@ public:
     void setIconSizePx(int px);
     void setSpacing(int px) { m_spacing = px; update(); }
 
+    // Ícones por estado (ex.: mute). Rasterizados uma vez por (arquivo, tamanho, DPR)
+    // num cache compartilhado; trocar checked/unchecked só troca o ponteiro.
+    void setStateIcons(const QString& uncheckedPath, const QString& checkedPath);
+
 protected:
     void paintEvent(QPaintEvent* e) override;
 
@@ -48,4 +54,16 @@ private:
     bool m_hovering = false;
 
     bool m_pressedActive = false; // <--- novo, corrige bug do pressed
+
+    // ícones por estado (cache compartilhado entre todos os botões)
+    QString m_iconPathOff;
+    QString m_iconPathOn;
+    QSharedPointer<const QPixmap> m_pmOff;
+    QSharedPointer<const QPixmap> m_pmOn;
+    int   m_pmPx  = -1;
+    qreal m_pmDpr = 0.0;
+
+    bool hasStateIcons() const { return !m_iconPathOff.isEmpty() || !m_iconPathOn.isEmpty(); }
+    void resolveStateIcons();
+    static QSharedPointer<const QPixmap> rasterizedIcon(const QString& path, int px, qreal dpr);
 };
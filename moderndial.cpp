@@ -1,5 +1,8 @@
 #include "moderndial.h"
+#include "trace.h"
 #include <QPainter>
+#include <QPaintEvent>
+#include <QFontMetrics>
 #include <QtMath>
 #include <cmath>
 
@@ -10,6 +13,10 @@ ModernDial::ModernDial(QWidget* parent) : QDial(parent) {
     setNotchesVisible(false);
     setMouseTracking(true);
     // setWrapping(false); // REMOVIDO: quem controla é a MainWindow (wrapping(true))
+
+    m_boldFont = font();
+    m_boldFont.setBold(true);
+    m_valueText.setPerformanceHint(QStaticText::AggressiveCaching);
 }
 
 static inline double clamp01(double x) {
@@ -18,59 +25,147 @@ static inline double clamp01(double x) {
     return x;
 }
 
+// ================= estado =================
+void ModernDial::setProgress01(double v) {
+    if (qFuzzyCompare(1.0 + m_progress01, 1.0 + v)) return;
+    m_progress01 = v;
+    updateArcRegion();
+    emit progress01Changed(v);
+}
+
+// Posição 0..1 DENTRO da volta atual
+double ModernDial::turn01() const {
+    const int minv = minimum();
+    const int maxv = maximum();
+    if (maxv <= minv) return 0.0;
+    return clamp01(double(value() - minv) / double(maxv - minv));
+}
+
+// Progresso TOTAL 0..1. Se a MainWindow não alimentou progress01,
+// faz fallback para turn01/turns (cresce devagar).
+double ModernDial::total01() const {
+    if (m_progress01 >= 0.0) return clamp01(m_progress01);
+    const int turns = qMax(1, m_turns);
+    return clamp01(turn01() / double(turns));
+}
+
+int ModernDial::displayedPercent() const {
+    const double pct = (m_displayTurnPercent && m_turns > 1)
+                           ? turn01()  * 100.0   // % da volta atual
+                           : total01() * 100.0;  // % TOTAL
+    return int(std::round(pct));
+}
+
+// ================= geometria / cache =================
+QRectF ModernDial::arcRect() const {
+    const int size   = qMin(width(), height());
+    const int margin = m_thickness/2 + 6;
+    return QRectF(margin, margin, size - 2*margin, size - 2*margin);
+}
+
+void ModernDial::ensureTrackCache() {
+    const qreal dpr = devicePixelRatioF();
+    if (m_trackSize == size() && qFuzzyCompare(m_trackDpr, dpr)
+        && m_trackCacheColor == m_trackColor && m_trackThickness == m_thickness
+        && m_trackFull == m_fullCircle)
+        return;
+
+    m_trackSize       = size();
+    m_trackDpr        = dpr;
+    m_trackCacheColor = m_trackColor;
+    m_trackThickness  = m_thickness;
+    m_trackFull       = m_fullCircle;
+
+    const QRectF rect = arcRect();
+
+    // Anel que contém arco + handle (handle tem raio thickness+2, +2 de anti-alias)
+    const qreal pad = m_thickness + 4;
+    m_arcRegion = QRegion(rect.adjusted(-pad, -pad, pad, pad).toAlignedRect(), QRegion::Ellipse)
+                      .subtracted(QRegion(rect.adjusted(pad, pad, -pad, -pad).toAlignedRect(), QRegion::Ellipse));
+
+    // Caixa do texto dimensionada pelo maior valor possível ("100%")
+    const QFontMetrics fm(m_boldFont);
+#if QT_VERSION >= QT_VERSION_CHECK(5,11,0)
+    const int tw = fm.horizontalAdvance(QStringLiteral("100%"));
+#else
+    const int tw = fm.width(QStringLiteral("100%"));
+#endif
+    const int th = fm.height();
+    m_valueTextRect = QRect((width() - tw)/2 - 2, (height() - th)/2 - 2, tw + 4, th + 4);
+
+    const QSize px = (QSizeF(size()) * dpr).toSize();
+    if (px.isEmpty() || rect.width() <= 0) { m_trackCache = QPixmap(); return; }
+
+    m_trackCache = QPixmap(px);
+    m_trackCache.setDevicePixelRatio(dpr);
+    m_trackCache.fill(Qt::transparent);
+
+    const double startDeg = m_fullCircle ? kStartDegFull : kStartDeg270;
+    const double spanDeg  = m_fullCircle ? kSpanDegFull  : kSpanDeg270;
+
+    QPainter tp(&m_trackCache);
+    tp.setRenderHint(QPainter::Antialiasing, true);
+    tp.setPen(QPen(m_trackColor, m_thickness, Qt::SolidLine, Qt::RoundCap));
+    tp.drawArc(rect, int(startDeg * 16), int(spanDeg * 16));
+}
+
+// Invalida só o anel (arco + handle) e, se o número mudou, a caixa do texto
+void ModernDial::updateArcRegion() {
+    if (m_arcRegion.isEmpty()) { update(); return; } // ainda sem geometria (antes do 1º paint)
+
+    QRegion r = m_arcRegion;
+    if (m_showValue && displayedPercent() != m_valueTextPct) r += m_valueTextRect;
+    update(r);
+}
+
+// ================= eventos =================
+void ModernDial::sliderChange(SliderChange change) {
+    // QAbstractSlider::sliderChange faz update() do widget inteiro
+    if (change == SliderValueChange) { updateArcRegion(); return; }
+    QDial::sliderChange(change);
+}
+
+void ModernDial::resizeEvent(QResizeEvent* e) {
+    m_arcRegion = QRegion();   // recalculado no próximo paint
+    QDial::resizeEvent(e);
+}
+
+void ModernDial::changeEvent(QEvent* e) {
+    if (e->type() == QEvent::FontChange) {
+        m_boldFont = font();
+        m_boldFont.setBold(true);
+        m_valueTextPct = -1;
+        m_trackSize    = QSize(); // força recalcular a caixa do texto
+    }
+    QDial::changeEvent(e);
+}
+
 void ModernDial::paintEvent(QPaintEvent* e) {
     Q_UNUSED(e);
+    TRACE_SCOPE("paint.ModernDial");
+    ensureTrackCache();
+
     QPainter p(this);
     p.setRenderHint(QPainter::Antialiasing, true);
 
-    const int w = width();
-    const int h = height();
-    const int size = qMin(w, h);
-
-    const int margin = m_thickness/2 + 6;
-    const QRectF rect(margin, margin, size - 2*margin, size - 2*margin);
+    const QRectF rect = arcRect();
 
     // Geometria do arco
     const double startDeg = m_fullCircle ? kStartDegFull : kStartDeg270;   // graus “Qt”
     const double spanDeg  = m_fullCircle ? kSpanDegFull  : kSpanDeg270;
 
-    // Fundo transparente
-    p.fillRect(rect.adjusted(-margin,-margin,margin,margin), Qt::transparent);
-
-    // Trilho base
-    QPen penTrack(m_trackColor, m_thickness, Qt::SolidLine, Qt::RoundCap);
-    p.setPen(penTrack);
-    p.drawArc(rect, int(startDeg * 16), int(spanDeg * 16));
-
-    // --------- Normalização do valor 0..1 DENTRO DA VOLTA ----------
-    const int minv = minimum();
-    const int maxv = maximum();
-    double norm01 = 0.0; // posição na volta atual
-    if (maxv > minv) {
-        norm01 = double(value() - minv) / double(maxv - minv);
-        norm01 = clamp01(norm01);
-    }
+    // Trilho base (cache)
+    if (!m_trackCache.isNull()) p.drawPixmap(0, 0, m_trackCache);
 
     // --------- PROGRESSO (VERDE) PROPORCIONAL AO TOTAL ----------
-    // Tente ler "progress01" da MainWindow (0..1 total após 10 voltas).
-    // Se não vier, faça fallback para norm01/turns (cresce devagar).
-    double total01 = -1.0;
-    if (this->property("progress01").isValid()) {
-        bool ok = false;
-        total01 = this->property("progress01").toDouble(&ok);
-        if (!ok) total01 = -1.0;
-    }
-    if (total01 < 0.0) {
-        const int turns = qMax(1, m_turns);
-        total01 = clamp01(norm01 / double(turns));
-    }
+    const double norm01 = turn01();
+    const double tot01  = total01();
 
-    double progressDeg = spanDeg * total01;
-    if (total01 >= 1.0) progressDeg = spanDeg; // garante círculo cheio no 100%
+    double progressDeg = spanDeg * tot01;
+    if (tot01 >= 1.0) progressDeg = spanDeg; // garante círculo cheio no 100%
 
-    QPen penProg(m_progressColor, m_thickness, Qt::SolidLine, Qt::RoundCap);
-    p.setPen(penProg);
     if (progressDeg > 0.0) {
+        p.setPen(QPen(m_progressColor, m_thickness, Qt::SolidLine, Qt::RoundCap));
         const int start16 = int(startDeg * 16);
         const int span16  = int(-progressDeg * 16); // negativo = horário
         p.drawArc(rect, start16, span16);
@@ -100,21 +195,15 @@ void ModernDial::paintEvent(QPaintEvent* e) {
 
     // --------- TEXTO (opcional) ----------
     if (m_showValue) {
-        p.setPen(m_textColor);
-        QFont f = p.font();
-        f.setBold(true);
-        p.setFont(f);
-
-        double percentToShow = 0.0;
-        if (m_displayTurnPercent && m_turns > 1) {
-            // % da volta atual (0..100 com base em norm01)
-            percentToShow = norm01 * 100.0;
-        } else {
-            // % TOTAL (0..100 com base em total01)
-            percentToShow = total01 * 100.0;
+        const int pct = displayedPercent();
+        if (pct != m_valueTextPct) {
+            m_valueText.setText(QString::number(pct) + QLatin1Char('%'));
+            m_valueText.prepare(QTransform(), m_boldFont);
+            m_valueTextPct = pct;
         }
-
-        const QString txt = QString::number(int(std::round(percentToShow))) + "%";
-        p.drawText(QRectF(0,0,w,h), Qt::AlignCenter, txt);
+        const QSizeF ts = m_valueText.size();
+        p.setFont(m_boldFont);
+        p.setPen(m_textColor);
+        p.drawStaticText(QPointF((width() - ts.width())/2.0, (height() - ts.height())/2.0), m_valueText);
     }
 }
@@ -1,6 +1,10 @@
 #pragma once
 #include <QDial>
 #include <QColor>
+#include <QFont>
+#include <QPixmap>
+#include <QRegion>
+#include <QStaticText>
 
 /*
  * ModernDial
@@ -26,11 +30,23 @@ class ModernDial : public QDial {
     Q_PROPERTY(bool   fullCircle     MEMBER m_fullCircle     DESIGNABLE true)     // arco 360° (true) ou 270° (false)
     Q_PROPERTY(bool   displayTurnPercent MEMBER m_displayTurnPercent DESIGNABLE true) // mostra % da volta atual
 
+    // Progresso TOTAL 0..1 (após N voltas), alimentado pela MainWindow. < 0 = não definido.
+    Q_PROPERTY(double progress01 READ progress01 WRITE setProgress01 NOTIFY progress01Changed)
+
 public:
     explicit ModernDial(QWidget* parent = nullptr);
 
+    double progress01() const { return m_progress01; }
+    void   setProgress01(double v);
+
+signals:
+    void progress01Changed(double v);
+
 protected:
     void paintEvent(QPaintEvent* e) override;
+    void resizeEvent(QResizeEvent* e) override;
+    void changeEvent(QEvent* e) override;
+    void sliderChange(SliderChange change) override;
 
 private:
     // Aparência (defaults)
@@ -46,6 +62,31 @@ private:
     bool m_fullCircle       = true;
     bool m_displayTurnPercent = false;
 
+    double m_progress01       = -1.0;
+
+    // ---- camadas em cache ----
+    // Trilho estático (pixmap DPR-aware); chave = tudo que muda o desenho dele.
+    QPixmap m_trackCache;
+    QSize   m_trackSize;
+    qreal   m_trackDpr       = 0.0;
+    QColor  m_trackCacheColor;
+    int     m_trackThickness = -1;
+    bool    m_trackFull      = true;
+    QRegion m_arcRegion;        // anel do arco + folga do handle (área invalidada em mudanças)
+
+    // Texto: fonte bold e glyph run (QStaticText) só refeitos quando mudam
+    QFont       m_boldFont;
+    QStaticText m_valueText;
+    int         m_valueTextPct = -1;
+    QRect       m_valueTextRect;
+
+    QRectF arcRect() const;
+    void   ensureTrackCache();
+    void   updateArcRegion();
+    double total01() const;
+    double turn01() const;
+    int    displayedPercent() const;
+
     // Ângulos no sistema do Qt (0° = 3h, CCW positivo)
     static constexpr double kStartDegFull = 90.0;   // topo (12h)
     static constexpr double kSpanDegFull  = 360.0;
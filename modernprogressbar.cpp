@@ -1,5 +1,7 @@
 #include "modernprogressbar.h"
+#include "trace.h"
 #include <QPainter>
+#include <QPaintEvent>
 #include <QStyleOptionProgressBar>
 #include <QtMath>
 
@@ -10,110 +12,192 @@ ModernProgressBar::ModernProgressBar(QWidget* parent)
     setMinimum(0);
     setMaximum(100);
     // Para barras verticais, use setOrientation(Qt::Vertical)
+    connect(this, &QProgressBar::valueChanged, this, &ModernProgressBar::onValueChanged);
 }
 
-void ModernProgressBar::paintEvent(QPaintEvent* e)
+// ================= geometria =================
+QRectF ModernProgressBar::barRect() const
 {
-    Q_UNUSED(e);
-    QPainter p(this);
-    p.setRenderHint(QPainter::Antialiasing, true);
-    p.setRenderHint(QPainter::TextAntialiasing, true);
+    return QRectF(rect()).adjusted(m_padding, m_padding, -m_padding, -m_padding);
+}
+
+// i = 0 é o primeiro gomo (esquerda na horizontal, baixo na vertical)
+QRectF ModernProgressBar::segmentRect(int i) const
+{
+    const QRectF R = barRect();
+    const int N = qMax(1, m_segments);
+    const double totalSpacing = m_spacing * (N - 1);
+
+    if (orientation() != Qt::Vertical) {
+        const double segW = qMax(1.0, (R.width() - totalSpacing) / double(N));
+        const double x = R.x() + i * (segW + m_spacing);
+        return QRectF(x, R.y(), segW, R.height());
+    }
+    const double segH = qMax(1.0, (R.height() - totalSpacing) / double(N));
+    const double yTop = R.bottom() - (i+1)*segH - i*m_spacing;
+    return QRectF(R.x(), yTop, R.width(), segH);
+}
+
+double ModernProgressBar::fracFor(int v) const
+{
+    const int minv = minimum();
+    const int maxv = maximum();
+    const int rng  = qMax(1, maxv - minv);
+    return clamp01(double(v - minv) / double(rng));
+}
+
+// Retângulo que cobre os gomos afetados pela mudança old -> new
+QRect ModernProgressBar::dirtyRectBetween(int oldValue, int newValue) const
+{
+    if (isTextVisible()) return rect(); // texto central muda junto
+
+    const int N = qMax(1, m_segments);
+    const int a = int(std::floor(fracFor(oldValue) * N + 1e-9));
+    const int b = int(std::floor(fracFor(newValue) * N + 1e-9));
+    const int lo = qBound(0, qMin(a, b), N - 1);
+    const int hi = qBound(0, qMax(a, b), N - 1);
+
+    // +1px de folga para a borda anti-alias
+    return segmentRect(lo).united(segmentRect(hi)).toAlignedRect().adjusted(-1, -1, 1, 1);
+}
+
+// ================= cache =================
+void ModernProgressBar::paintStrip(QPainter& p, bool filled) const
+{
+    p.setPen(Qt::NoPen);
 
     // Fundo total do widget
     if (m_bg.alpha() > 0) {
-        p.setPen(Qt::NoPen);
         p.setBrush(m_bg);
         p.drawRoundedRect(rect(), m_radius, m_radius);
     }
 
-    // Área interna da barra
-    const QRectF R = rect().adjusted(m_padding, m_padding, -m_padding, -m_padding);
-
-    // Segurança
+    const QRectF R = barRect();
     if (R.width() <= 0 || R.height() <= 0) return;
 
-    // Proporção 0..1
-    const int minv = minimum();
-    const int maxv = maximum();
-    const int rng  = qMax(1, maxv - minv);
-    const double frac = clamp01(double(value() - minv) / double(rng));
-
-    // Segmentação
     const int N = qMax(1, m_segments);
-    const bool vertical = (orientation() == Qt::Vertical);
+    for (int i = 0; i < N; ++i) {
+        const QRectF seg = segmentRect(i);
+        p.setBrush(m_track);
+        p.drawRoundedRect(seg, m_radius, m_radius);
+        if (filled) {
+            p.setBrush(m_fill);
+            p.drawRoundedRect(seg, m_radius, m_radius);
+        }
+    }
+}
 
-    // Cálculo de tamanho de cada gomo e espaçamento total
-    if (!vertical) {
-        // Horizontal
-        const double totalSpacing = m_spacing * (N - 1);
-        const double segW = qMax(1.0, (R.width() - totalSpacing) / double(N));
-        const double segH = R.height();
+void ModernProgressBar::ensureCache()
+{
+    const qreal dpr = devicePixelRatioF();
+    if (!m_cacheDirty && m_cacheSize == size() && qFuzzyCompare(m_cacheDpr, dpr)
+        && m_cacheOrient == orientation())
+        return;
+
+    m_cacheSize   = size();
+    m_cacheDpr    = dpr;
+    m_cacheOrient = orientation();
+    m_cacheDirty  = false;
+
+    const QSize px = (QSizeF(size()) * dpr).toSize();
+    if (px.isEmpty()) {
+        m_emptyStrip = QPixmap();
+        m_fullStrip  = QPixmap();
+        return;
+    }
 
-        // quantos gomos cheios + parcial
-        const double totalSegs = frac * N;
-        const int full = int(std::floor(totalSegs + 1e-9));
-        const double part = totalSegs - full;
+    auto render = [&](bool filled) {
+        QPixmap pm(px);
+        pm.setDevicePixelRatio(dpr);
+        pm.fill(Qt::transparent);
+        QPainter sp(&pm);
+        sp.setRenderHint(QPainter::Antialiasing, true);
+        paintStrip(sp, filled);
+        return pm;
+    };
+    m_emptyStrip = render(false);
+    m_fullStrip  = render(true);
+}
+
+void ModernProgressBar::resizeEvent(QResizeEvent* e)
+{
+    m_cacheDirty = true;
+    QProgressBar::resizeEvent(e);
+}
 
-        // Desenha gomos
-        p.setPen(Qt::NoPen);
-        for (int i = 0; i < N; ++i) {
-            const double x = R.x() + i * (segW + m_spacing);
-            QRectF seg(x, R.y(), segW, segH);
+// ================= valor =================
+// QProgressBar::setValue emite valueChanged e logo depois chama repaint() (widget
+// inteiro, síncrono). Aqui as pinturas ficam desligadas até a próxima volta do
+// event loop, e lá só os gomos entre o último valor pintado e o atual são invalidados.
+// Liga WA_UpdatesDisabled direto — setUpdatesEnabled(true) faria um update() total na volta.
+void ModernProgressBar::onValueChanged()
+{
+    if (!isVisible() || m_flushPending || testAttribute(Qt::WA_UpdatesDisabled)) return;
+    m_flushPending = true;
+    setAttribute(Qt::WA_UpdatesDisabled, true);
+    QMetaObject::invokeMethod(this, [this] {
+        setAttribute(Qt::WA_UpdatesDisabled, false);
+        m_flushPending = false;
+        if (m_cacheDirty)                update();   // resize/estilo no intervalo
+        else if (value() != m_shownValue) update(dirtyRectBetween(m_shownValue, value()));
+    }, Qt::QueuedConnection);
+}
 
-            // trilho
-            p.setBrush(m_track);
-            p.drawRoundedRect(seg, m_radius, m_radius);
+// ================= pintura =================
+// No máximo: faixa vazia + faixa cheia (recortada) + 1 gomo parcial.
+void ModernProgressBar::paintEvent(QPaintEvent* e)
+{
+    TRACE_SCOPE("paint.ModernProgressBar");
+    ensureCache();
+    m_shownValue = value();
+    if (m_emptyStrip.isNull()) return;
 
-            // preenchimento
-            if (i < full) {
-                p.setBrush(m_fill);
-                p.drawRoundedRect(seg, m_radius, m_radius);
-            } else if (i == full && part > 0.0) {
-                p.setBrush(m_fill);
-                QRectF partial = seg;
-                partial.setWidth(segW * part);
-                // arredondar só a esquerda para não “apontar” no meio
-                // truque: desenha parcial e depois um retângulo “tampa” pequeno
-                p.drawRoundedRect(partial, m_radius, m_radius);
-            }
-        }
-    } else {
-        // Vertical (de baixo para cima)
-        const double totalSpacing = m_spacing * (N - 1);
-        const double segH = qMax(1.0, (R.height() - totalSpacing) / double(N));
-        const double segW = R.width();
-
-        const double totalSegs = frac * N;
-        const int full = int(std::floor(totalSegs + 1e-9));
-        const double part = totalSegs - full;
+    QPainter p(this);
+    p.setClipRect(e->rect());
 
-        p.setPen(Qt::NoPen);
-        for (int i = 0; i < N; ++i) {
-            // i = 0 é o gomo de baixo
-            const double y = R.bottom() - (i+1)*segH - i*m_spacing + (segH - segH); // simplifica
-            const double yTop = R.bottom() - (i+1)*segH - i*m_spacing;
-            QRectF seg(R.x(), yTop, segW, segH);
+    // trilho (e fundo)
+    p.drawPixmap(0, 0, m_emptyStrip);
 
-            // trilho
-            p.setBrush(m_track);
-            p.drawRoundedRect(seg, m_radius, m_radius);
+    const QRectF R = barRect();
+    if (R.width() > 0 && R.height() > 0) {
+        const int N = qMax(1, m_segments);
+        const double totalSegs = fracFor(value()) * N;
+        const int full = qMin(N, int(std::floor(totalSegs + 1e-9)));
+        const double part = totalSegs - full;
+        const bool vertical = (orientation() == Qt::Vertical);
+
+        // gomos cheios: recorte da faixa cheia até o fim do último gomo cheio
+        if (full > 0) {
+            const QRectF last = segmentRect(full - 1);
+            const QRectF fullArea = vertical
+                ? QRectF(0, std::floor(last.top()), width(), height() - std::floor(last.top()))
+                : QRectF(0, 0, std::ceil(last.right()), height());
+            p.save();
+            p.setClipRect(fullArea, Qt::IntersectClip);
+            p.drawPixmap(0, 0, m_fullStrip);
+            p.restore();
+        }
 
-            // preenchimento
-            if (i < full) {
-                p.setBrush(m_fill);
-                p.drawRoundedRect(seg, m_radius, m_radius);
-            } else if (i == full && part > 0.0) {
-                p.setBrush(m_fill);
-                QRectF partial = seg;
-                partial.setY(seg.y() + (1.0 - part) * segH);
-                partial.setHeight(segH * part);
-                p.drawRoundedRect(partial, m_radius, m_radius);
+        // gomo parcial
+        if (full < N && part > 0.0) {
+            const QRectF seg = segmentRect(full);
+            QRectF partial = seg;
+            if (vertical) {
+                partial.setY(seg.y() + (1.0 - part) * seg.height());
+                partial.setHeight(seg.height() * part);
+            } else {
+                partial.setWidth(seg.width() * part);
             }
+            p.setRenderHint(QPainter::Antialiasing, true);
+            p.setPen(Qt::NoPen);
+            p.setBrush(m_fill);
+            p.drawRoundedRect(partial, m_radius, m_radius);
         }
     }
 
     // Texto central (se ligado)
     if (isTextVisible()) {
+        p.setRenderHint(QPainter::TextAntialiasing, true);
         p.setPen(m_text);
         QFont f = p.font();
         f.setBold(true);
@@ -122,7 +206,7 @@ void ModernProgressBar::paintEvent(QPaintEvent* e)
         // Use o texto do QProgressBar (ex.: "42%") ou formate o seu
         QString t = text();
         if (t.isEmpty()) {
-            t = QString::number(int(std::round(frac * 100.0))) + "%";
+            t = QString::number(int(std::round(fracFor(value()) * 100.0))) + "%";
         }
         p.drawText(rect(), Qt::AlignCenter, t);
     }
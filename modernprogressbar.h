@@ -1,6 +1,7 @@
 #pragma once
 #include <QProgressBar>
 #include <QColor>
+#include <QPixmap>
 
 class ModernProgressBar : public QProgressBar
 {
@@ -9,18 +10,20 @@ public:
     explicit ModernProgressBar(QWidget* parent = nullptr);
 
     // Estilo (getters/setters simples; pode também usar setProperty no .ui/.cpp)
-    void setSegmentCount(int n)      { m_segments = qMax(1, n); update(); }
-    void setSegmentSpacing(int px)   { m_spacing  = qMax(0, px); update(); }
-    void setRadius(int r)            { m_radius   = qMax(0, r); update(); }
-    void setPadding(int px)          { m_padding  = qMax(0, px); update(); }
-
-    void setTrackColor(const QColor& c)   { m_track = c; update(); }
-    void setFillColor(const QColor& c)    { m_fill  = c; update(); }
-    void setBackgroundColor(const QColor& c) { m_bg = c; update(); }
+    void setSegmentCount(int n)      { m_segments = qMax(1, n); invalidateCache(); }
+    void setSegmentSpacing(int px)   { m_spacing  = qMax(0, px); invalidateCache(); }
+    void setRadius(int r)            { m_radius   = qMax(0, r); invalidateCache(); }
+    void setPadding(int px)          { m_padding  = qMax(0, px); invalidateCache(); }
+
+    // cores próprias: o OsccbStyle não as sobrescreve no polish ("ownColors")
+    void setTrackColor(const QColor& c)   { m_track = c; markOwnColors(); invalidateCache(); }
+    void setFillColor(const QColor& c)    { m_fill  = c; markOwnColors(); invalidateCache(); }
+    void setBackgroundColor(const QColor& c) { m_bg = c; markOwnColors(); invalidateCache(); }
     void setTextColor(const QColor& c)    { m_text = c; update(); }
 
 protected:
     void paintEvent(QPaintEvent* e) override;
+    void resizeEvent(QResizeEvent* e) override;
 
 private:
     // estilo
@@ -34,6 +37,28 @@ private:
     QColor m_bg    = Qt::transparent;       // fundo atrás da barra
     QColor m_text  = Qt::white;             // texto central (se textVisible=true)
 
+    // cache das faixas pré-renderizadas (vazia / cheia), em pixels físicos
+    QPixmap         m_emptyStrip;
+    QPixmap         m_fullStrip;
+    QSize           m_cacheSize;
+    qreal           m_cacheDpr    = 0.0;
+    Qt::Orientation m_cacheOrient = Qt::Horizontal;
+    bool            m_cacheDirty  = true;
+
+    // valueChanged: só os gomos entre o último valor pintado e o atual
+    int  m_shownValue   = 0;
+    bool m_flushPending = false;
+    void onValueChanged();
+
+    void    invalidateCache() { m_cacheDirty = true; update(); }
+    void    markOwnColors()   { setProperty("ownColors", true); }
+    void    ensureCache();
+    void    paintStrip(QPainter& p, bool filled) const;
+    QRectF  barRect() const;
+    QRectF  segmentRect(int i) const;
+    double  fracFor(int v) const;
+    QRect   dirtyRectBetween(int oldValue, int newValue) const;
+
     // util
     static inline double clamp01(double x) {
         return x < 0.0 ? 0.0 : (x > 1.0 ? 1.0 : x);
@@ -0,0 +1,174 @@
+#include "numericreadout.h"
+#include "trace.h"
+#include <QPainter>
+#include <QPaintEvent>
+#include <QFontMetrics>
+#include <QEvent>
+#include <cmath>
+#include <cstring>
+
+static constexpr double kPow10[] = { 1.0, 10.0, 100.0, 1e3, 1e4, 1e5, 1e6 };
+
+NumericReadout::NumericReadout(QWidget* parent)
+    : QLabel(parent)
+{
+    setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Preferred);
+    m_len = format(m_value, m_buf);
+}
+
+void NumericReadout::setFormat(int intDigits, int decimals)
+{
+    m_intDigits = qBound(1, intDigits, 9);
+    m_decimals  = qBound(0, decimals, 6);
+    m_len = format(m_value, m_buf);
+    updateGeometry();
+    update();
+}
+
+// ================= formatação (sem alocação) =================
+// Ponto fixo com '.', independente de locale (snprintf usaria ',' em pt_BR).
+int NumericReadout::format(double v, char* out) const
+{
+    if (!std::isfinite(v)) v = 0.0;
+
+    long long n = std::llround(std::fabs(v) * kPow10[m_decimals]);
+    const bool neg = (v < 0.0) && n != 0;
+
+    char tmp[kMaxChars];
+    int k = 0;
+    for (int d = 0; d < m_decimals; ++d) { tmp[k++] = char('0' + n % 10); n /= 10; }
+    if (m_decimals > 0) tmp[k++] = '.';
+    do { tmp[k++] = char('0' + n % 10); n /= 10; } while (n && k < kMaxChars - 2);
+    if (neg) tmp[k++] = '-';
+
+    for (int i = 0; i < k; ++i) out[i] = tmp[k - 1 - i];
+    return k;
+}
+
+void NumericReadout::setValue(double v)
+{
+    m_value = v;
+
+    char buf[kMaxChars];
+    const int len = format(v, buf);
+    if (len == m_len && std::memcmp(buf, m_buf, size_t(len)) == 0) return; // mesmo texto na tela
+
+    std::memcpy(m_buf, buf, size_t(len));
+    m_len = len;
+    update(); // só o próprio retângulo; sizeHint não muda
+}
+
+// ================= atlas de glifos =================
+int NumericReadout::glyphIndex(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c == '.') return 10;
+    if (c == '-') return 11;
+    return -1;
+}
+
+void NumericReadout::ensureAtlas()
+{
+    const qreal dpr = devicePixelRatioF();
+    if (!m_atlasDirty && qFuzzyCompare(m_atlasDpr, dpr)) return;
+    m_atlasDirty = false;
+    m_atlasDpr   = dpr;
+
+    const QFontMetrics fm(font());
+    m_cellH = fm.height();
+
+    int x = 0;
+    for (int i = 0; i < kNumGlyphs; ++i) {
+#if QT_VERSION >= QT_VERSION_CHECK(5,11,0)
+        m_adv[i] = fm.horizontalAdvance(QLatin1Char(kGlyphs[i]));
+#else
+        m_adv[i] = fm.width(QLatin1Char(kGlyphs[i]));
+#endif
+        m_atlasX[i] = x;
+        x += m_adv[i];
+    }
+
+    m_atlas = QPixmap((QSizeF(x, m_cellH) * dpr).toSize());
+    m_atlas.setDevicePixelRatio(dpr);
+    m_atlas.fill(Qt::transparent);
+
+    QPainter ap(&m_atlas);
+    ap.setRenderHint(QPainter::TextAntialiasing, true);
+    ap.setFont(font());
+    ap.setPen(palette().color(foregroundRole())); // respeita "color:" do stylesheet
+    for (int i = 0; i < kNumGlyphs; ++i)
+        ap.drawText(QPointF(m_atlasX[i], fm.ascent()), QString(QLatin1Char(kGlyphs[i])));
+}
+
+void NumericReadout::changeEvent(QEvent* e)
+{
+    switch (e->type()) {
+    case QEvent::FontChange:
+    case QEvent::PaletteChange:
+    case QEvent::StyleChange:
+        m_atlasDirty = true;
+        updateGeometry();
+        break;
+    default:
+        break;
+    }
+    QLabel::changeEvent(e);
+}
+
+// ================= tamanho fixo =================
+QSize NumericReadout::sizeHint() const
+{
+    const QFontMetrics fm(font());
+#if QT_VERSION >= QT_VERSION_CHECK(5,11,0)
+    const int digitW = fm.horizontalAdvance(QLatin1Char('0'));
+    const int dotW   = fm.horizontalAdvance(QLatin1Char('.'));
+#else
+    const int digitW = fm.width(QLatin1Char('0'));
+    const int dotW   = fm.width(QLatin1Char('.'));
+#endif
+    int w = m_intDigits * digitW;
+    if (m_decimals > 0) w += dotW + m_decimals * digitW;
+
+    const QMargins m = contentsMargins();
+    return QSize(w + m.left() + m.right() + 2, fm.height() + m.top() + m.bottom());
+}
+
+QSize NumericReadout::minimumSizeHint() const
+{
+    return sizeHint();
+}
+
+// ================= pintura =================
+void NumericReadout::paintEvent(QPaintEvent* e)
+{
+    Q_UNUSED(e);
+    TRACE_SCOPE("paint.NumericReadout");
+    ensureAtlas();
+    if (m_atlas.isNull() || m_len <= 0) return;
+
+    int textW = 0;
+    for (int i = 0; i < m_len; ++i) {
+        const int g = glyphIndex(m_buf[i]);
+        if (g >= 0) textW += m_adv[g];
+    }
+
+    const QRect cr = contentsRect();
+    const Qt::Alignment al = alignment();
+    int x = cr.left();
+    if (al & Qt::AlignRight)        x = cr.right() + 1 - textW;
+    else if (al & Qt::AlignHCenter) x = cr.left() + (cr.width() - textW) / 2;
+    int y = cr.top() + (cr.height() - m_cellH) / 2;
+    if (al & Qt::AlignTop)          y = cr.top();
+    else if (al & Qt::AlignBottom)  y = cr.bottom() + 1 - m_cellH;
+
+    QPainter p(this);
+    const qreal dpr = m_atlasDpr;
+    for (int i = 0; i < m_len; ++i) {
+        const int g = glyphIndex(m_buf[i]);
+        if (g < 0) continue;
+        // retângulo de origem em pixels físicos do atlas
+        p.drawPixmap(QRectF(x, y, m_adv[g], m_cellH), m_atlas,
+                     QRectF(m_atlasX[g] * dpr, 0, m_adv[g] * dpr, m_cellH * dpr));
+        x += m_adv[g];
+    }
+}
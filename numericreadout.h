@@ -0,0 +1,58 @@
+#pragma once
+#include <QLabel>
+#include <QPixmap>
+
+/*
+ * NumericReadout
+ * - Substitui o QLabel dos valores de fader (ex.: "0.7500")
+ * - Formata num buffer na pilha (sem QString), desenha os dígitos a partir
+ *   de um atlas de glifos em cache (DPR-aware)
+ * - sizeHint fixo (largura do maior valor possível): nunca provoca relayout
+ * - Herda QLabel só para aceitar as propriedades do .ui (fonte, stylesheet, alinhamento)
+ */
+
+class NumericReadout : public QLabel
+{
+    Q_OBJECT
+public:
+    explicit NumericReadout(QWidget* parent = nullptr);
+
+    // intDigits: dígitos inteiros reservados no sizeHint; decimals: casas decimais (0..6)
+    void setFormat(int intDigits, int decimals);
+
+    double value() const { return m_value; }
+
+    QSize sizeHint() const override;
+    QSize minimumSizeHint() const override;
+
+public slots:
+    void setValue(double v);
+
+protected:
+    void paintEvent(QPaintEvent* e) override;
+    void changeEvent(QEvent* e) override;
+
+private:
+    static constexpr int  kMaxChars = 24;
+    static constexpr char kGlyphs[] = "0123456789.-";
+    static constexpr int  kNumGlyphs = sizeof(kGlyphs) - 1;
+
+    double m_value     = 0.0;
+    int    m_intDigits = 1;
+    int    m_decimals  = 4;
+
+    char   m_buf[kMaxChars]{};
+    int    m_len = 0;
+
+    // atlas: uma linha com todos os glifos, em pixels físicos
+    QPixmap m_atlas;
+    qreal   m_atlasDpr = 0.0;
+    bool    m_atlasDirty = true;
+    int     m_adv[kNumGlyphs]{};
+    int     m_atlasX[kNumGlyphs]{};
+    int     m_cellH = 0;
+
+    int  format(double v, char* out) const;
+    void ensureAtlas();
+    static int glyphIndex(char c);
+};
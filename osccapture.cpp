@@ -0,0 +1,92 @@
+#include "osccapture.h"
+#include <QtEndian>
+#include <cstring>
+
+static constexpr char    kMagic[6] = { 'O','S','C','C','A','P' };
+static constexpr quint16 kVersion  = 1;
+static constexpr int     kHeaderLen = 12;
+static constexpr int     kRecordLen = 8;
+static constexpr qint64  kFlushNs  = 1000000000;   // queda do app perde no máx. ~1 s
+
+// ============ Escrita ============
+bool OscCaptureWriter::open(const QString& path)
+{
+    close();
+    m_file.setFileName(path);
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate)) return false;
+
+    char hdr[kHeaderLen] = {};
+    std::memcpy(hdr, kMagic, sizeof(kMagic));
+    qToLittleEndian<quint16>(kVersion, hdr + 6);
+    m_file.write(hdr, kHeaderLen);
+
+    m_lastNs  = -1;
+    m_flushNs = -1;
+    m_records = 0;
+    return true;
+}
+
+void OscCaptureWriter::close()
+{
+    if (m_file.isOpen()) m_file.close();
+}
+
+void OscCaptureWriter::write(Direction dir, const QByteArray& datagram, qint64 nowNs)
+{
+    if (!m_file.isOpen() || datagram.size() > 0xFFFF) return;
+
+    // o resto abaixo de 1 µs fica para o próximo delta: o replay não deriva
+    qint64 deltaUs = 0;
+    if (m_lastNs < 0) {
+        m_lastNs = nowNs;
+    } else {
+        deltaUs = qBound<qint64>(0, (nowNs - m_lastNs) / 1000, 0xFFFFFFFFll);
+        m_lastNs = deltaUs == 0xFFFFFFFFll ? nowNs : m_lastNs + deltaUs * 1000;
+    }
+
+    char rec[kRecordLen] = {};
+    qToLittleEndian<quint32>(quint32(deltaUs), rec);
+    qToLittleEndian<quint16>(quint16(datagram.size()), rec + 4);
+    rec[6] = char(dir);
+
+    m_file.write(rec, kRecordLen);        // QFile já bufferiza
+    m_file.write(datagram);
+    ++m_records;
+
+    if (m_flushNs < 0) m_flushNs = nowNs;
+    if (nowNs - m_flushNs >= kFlushNs) { m_file.flush(); m_flushNs = nowNs; }
+}
+
+// ============ Leitura ============
+bool OscCaptureReader::open(const QString& path)
+{
+    m_file.setFileName(path);
+    if (!m_file.open(QIODevice::ReadOnly)) return false;
+
+    char hdr[kHeaderLen];
+    if (m_file.read(hdr, kHeaderLen) != kHeaderLen ||
+        std::memcmp(hdr, kMagic, sizeof(kMagic)) != 0 ||
+        qFromLittleEndian<quint16>(hdr + 6) != kVersion) {
+        m_file.close();
+        return false;
+    }
+    m_atUs = 0;
+    return true;
+}
+
+bool OscCaptureReader::next(Record& r)
+{
+    char rec[kRecordLen];
+    if (m_file.read(rec, kRecordLen) != kRecordLen) return false;
+
+    const quint32 deltaUs = qFromLittleEndian<quint32>(rec);
+    const quint16 len     = qFromLittleEndian<quint16>(rec + 4);
+
+    r.datagram.resize(len);
+    if (m_file.read(r.datagram.data(), len) != len) return false;
+
+    m_atUs += deltaUs;
+    r.atUs = m_atUs;
+    r.dir  = quint8(rec[6]);
+    return true;
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <QtGlobal>
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+
+/*
+ * Captura de tráfego OSC (.osccap) — gravação e leitura sequencial
+ *
+ * Formato (little-endian):
+ *   cabeçalho: "OSCCAP" u16 versão(1) u32 reservado          (12 bytes)
+ *   registro:  u32 delta_us  u16 tamanho  u8 direção  u8 0   (8 bytes)
+ *              + datagrama (tamanho bytes)
+ * - delta_us: µs desde o registro anterior (relógio monotônico; a fração de
+ *   µs é carregada para o registro seguinte)
+ * - o arquivo vai para o disco a cada ~1 s de tráfego
+ * - direção: 0 = recebido do mixer, 1 = enviado ao mixer
+ * Um serviço de 2 h com meters a 20 Hz fica na casa de centenas de MB;
+ * o cabeçalho por registro é só 8 bytes.
+ */
+
+class OscCaptureWriter
+{
+public:
+    enum Direction : quint8 { Rx = 0, Tx = 1 };
+
+    bool open(const QString& path);
+    void close();
+    bool isOpen() const { return m_file.isOpen(); }
+
+    void write(Direction dir, const QByteArray& datagram, qint64 nowNs);
+
+    quint64 records() const { return m_records; }
+
+private:
+    QFile   m_file;
+    qint64  m_lastNs  = -1;     // instante já contado nos deltas gravados
+    qint64  m_flushNs = -1;
+    quint64 m_records = 0;
+};
+
+class OscCaptureReader
+{
+public:
+    struct Record {
+        qint64     atUs = 0;     // desde o início da captura
+        quint8     dir  = 0;     // OscCaptureWriter::Direction
+        QByteArray datagram;
+    };
+
+    bool open(const QString& path);
+    void close() { m_file.close(); }
+    bool next(Record& r);        // false = fim ou arquivo truncado
+
+private:
+    QFile  m_file;
+    qint64 m_atUs = 0;
+};
@@ -0,0 +1,67 @@
+/*
+ * osccb_shm.h — layout do segmento de estado exportado pelo osccb
+ * (header C puro: overlays, monitores e scripts leem sem abrir sessão OSC)
+ *
+ * Segmento: arquivo mapeado, por padrão /dev/shm/osccb-state (Linux).
+ *   int fd = open("/dev/shm/osccb-state", O_RDONLY);
+ *   const struct osccb_shm_state* shm =
+ *       mmap(NULL, sizeof *shm, PROT_READ, MAP_SHARED, fd, 0);
+ *   struct osccb_shm_state s;
+ *   if (osccb_shm_read(shm, &s) == 0) { ... s.fader[0], s.meter_db256[0] ... }
+ *
+ * Concorrência: um escritor (o app), qualquer número de leitores.
+ * seq é um seqlock: ímpar = escrita em andamento; o leitor copia o segmento
+ * e só aceita a cópia se seq era par e não mudou (osccb_shm_read faz isso).
+ * Little-endian, alinhamento natural; magic/version/size conferem o layout.
+ */
+#ifndef OSCCB_SHM_H
+#define OSCCB_SHM_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define OSCCB_SHM_MAGIC       0x4253434Fu   /* "OCSB" */
+#define OSCCB_SHM_VERSION     1u
+#define OSCCB_SHM_DEFAULT_PATH "/dev/shm/osccb-state"
+#define OSCCB_SHM_MAX_CH      32
+#define OSCCB_SHM_MAX_METERS  96
+
+struct osccb_shm_state {
+    /* cabeçalho (fixo) */
+    uint32_t magic;            /* OSCCB_SHM_MAGIC */
+    uint32_t version;          /* OSCCB_SHM_VERSION */
+    uint32_t size;             /* sizeof(struct osccb_shm_state) */
+    uint32_t channels;         /* canais de fader/mute válidos (1..OSCCB_SHM_MAX_CH) */
+
+    uint32_t seq;              /* seqlock (par = estável) */
+    uint32_t pad0;
+    uint64_t updates;          /* nº de atualizações publicadas */
+    int64_t  wall_ms;          /* epoch (ms) da última atualização */
+
+    /* estado dos canais; índice 0 = /ch/01 */
+    float    fader[OSCCB_SHM_MAX_CH];   /* 0..1 (lei de fader do mixer); < 0 = desconhecido */
+    int32_t  on[OSCCB_SHM_MAX_CH];      /* 1 = ligado, 0 = mudo, -1 = desconhecido */
+    float    lr_fader;
+    int32_t  lr_on;
+
+    /* meters: dB * 256 (int16), como chegam do mixer */
+    uint32_t meter_count;                        /* valores válidos em meter_db256 */
+    int16_t  meter_db256[OSCCB_SHM_MAX_METERS];  /* /meters/1 */
+    int16_t  lr_db256[2];                        /* /meters/3: L, R */
+    int64_t  meter_wall_ms;                      /* epoch (ms) do último frame de meter */
+};
+
+/* 0 = cópia consistente em *out; -1 = escritor ocupado (tente de novo) */
+static inline int osccb_shm_read(const struct osccb_shm_state* shm, struct osccb_shm_state* out)
+{
+    for (int tries = 0; tries < 64; ++tries) {
+        const uint32_t s1 = __atomic_load_n(&shm->seq, __ATOMIC_ACQUIRE);
+        if (s1 & 1u) continue;
+        memcpy(out, (const void*)shm, sizeof *out);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&shm->seq, __ATOMIC_RELAXED) == s1) return 0;
+    }
+    return -1;
+}
+
+#endif /* OSCCB_SHM_H */
@@ -0,0 +1,303 @@
+#include "osccbstyle.h"
+#include "modernbutton.h"
+#include "moderndial.h"
+#include "modernprogressbar.h"
+
+#include <QStyleFactory>
+#include <QStyleOption>
+#include <QPainter>
+#include <QWidget>
+#include <QPushButton>
+#include <QProgressBar>
+
+// ===================== cores do tema =====================
+namespace {
+const QColor kWindowBg    ("#140d0b");
+const QColor kCardBg      ("#3E2723");
+const QColor kHighlightBg ("#281917");
+const QColor kFieldBg     ("#1f2125");
+const QColor kMeterBorder ("#3a3f47");
+const QColor kMeterTop    ("#001f4d");
+const QColor kMeterBottom ("#00ffff");
+const QColor kGreen       ("#00C853");
+const QColor kGreenLight  ("#00ff1e");
+const QColor kGrayBorder  (80, 80, 80);
+const QColor kReadout     ("#ffffaa");
+
+// Propriedade com o papel já resolvido (int), lida nos draw*
+const char* const kRoleIdProp = "_themeRoleId";
+// Cores do tema nos Modern* já aplicadas (o polish se repete a cada troca de estilo)
+const char* const kColorsProp = "_themeColors";
+
+OsccbStyle::Role parseRole(const QString& r)
+{
+    if (r == QLatin1String("window"))      return OsccbStyle::RoleWindow;
+    if (r == QLatin1String("tabs"))        return OsccbStyle::RoleTabs;
+    if (r == QLatin1String("card"))        return OsccbStyle::RoleCard;
+    if (r == QLatin1String("panel"))       return OsccbStyle::RolePanel;
+    if (r == QLatin1String("highlight"))   return OsccbStyle::RoleHighlight;
+    if (r == QLatin1String("console"))     return OsccbStyle::RoleConsole;
+    if (r == QLatin1String("title"))       return OsccbStyle::RoleTitle;
+    if (r == QLatin1String("menu"))        return OsccbStyle::RoleMenu;
+    if (r == QLatin1String("accent"))      return OsccbStyle::RoleAccent;
+    if (r == QLatin1String("field"))       return OsccbStyle::RoleField;
+    if (r == QLatin1String("readout"))     return OsccbStyle::RoleReadout;
+    if (r == QLatin1String("hint"))        return OsccbStyle::RoleHint;
+    if (r == QLatin1String("placeholder")) return OsccbStyle::RolePlaceholder;
+    return OsccbStyle::RoleNone;
+}
+
+void drawRounded(QPainter* p, const QRectF& r, const QColor& fill,
+                 const QColor& border, qreal borderW, qreal radius)
+{
+    p->save();
+    p->setRenderHint(QPainter::Antialiasing, true);
+    p->setBrush(fill.isValid() ? QBrush(fill) : QBrush(Qt::NoBrush));
+    if (borderW > 0) p->setPen(QPen(border, borderW));
+    else             p->setPen(Qt::NoPen);
+    const qreal h = borderW / 2.0;
+    p->drawRoundedRect(r.adjusted(h, h, -h, -h), radius, radius);
+    p->restore();
+}
+} // namespace
+
+OsccbStyle::OsccbStyle()
+    : QProxyStyle(QStyleFactory::create(QStringLiteral("Fusion")))
+{
+}
+
+OsccbStyle::Role OsccbStyle::roleOf(const QWidget* w)
+{
+    if (!w) return RoleNone;
+    return Role(w->property(kRoleIdProp).toInt());
+}
+
+// ===================== paleta =====================
+QPalette OsccbStyle::standardPalette() const
+{
+    QPalette p = QProxyStyle::standardPalette();
+    p.setColor(QPalette::Window,        QColor("#1f2125"));
+    p.setColor(QPalette::WindowText,    QColor("#e9eef3"));
+    p.setColor(QPalette::Base,          QColor("#2a2d34"));
+    p.setColor(QPalette::AlternateBase, QColor("#23262b"));
+    p.setColor(QPalette::Button,        QColor("#2f333a"));
+    p.setColor(QPalette::Text,          QColor("#e9eef3"));
+    p.setColor(QPalette::ButtonText,    QColor("#e9eef3"));
+    p.setColor(QPalette::BrightText,    QColor("#ffffff"));
+    p.setColor(QPalette::Highlight,     QColor("#3aaed8"));
+    p.setColor(QPalette::HighlightedText, QColor("#0b0d10"));
+    return p;
+}
+
+void OsccbStyle::polish(QPalette& pal)
+{
+    pal = standardPalette();
+}
+
+// Resolve o papel uma vez e aplica paleta; o desenho fica nos draw*
+void OsccbStyle::polish(QWidget* w)
+{
+    QProxyStyle::polish(w);
+
+    // ---- Modern*: tema pelas propriedades que os widgets já expõem ----
+    // uma vez por widget, e nunca sobre cores próprias ("ownColors" no .ui ou no código)
+    const bool themeColors = !w->property("ownColors").toBool() && !w->property(kColorsProp).toBool();
+    if (auto* d = qobject_cast<ModernDial*>(w); d && themeColors) {
+        d->setProperty("trackColor",    QColor("#e6e6e6"));
+        d->setProperty("progressColor", kGreen);
+        d->setProperty("handleColor",   QColor("#ffffff"));
+        d->setProperty("textColor",     QColor("white"));
+        d->setProperty("thickness",     6);
+        d->setProperty(kColorsProp, true);
+    } else if (auto* pb = qobject_cast<ModernProgressBar*>(w); pb && themeColors) {
+        pb->setTrackColor(QColor("#1e1e1e"));
+        pb->setFillColor(kGreen);
+        pb->setProperty(kColorsProp, true);
+    } else if (auto* mb = qobject_cast<ModernButton*>(w); mb && mb->isCheckable()) {
+        // mutes e cenas: a fonte vinha do styleSheet (16px); só se o .ui não fixou tamanho
+        QFont f = mb->font();
+        if (!(f.resolveMask() & QFont::SizeResolved)) {
+            f.setFamilies({ QStringLiteral("Inter"), QStringLiteral("Roboto"), QStringLiteral("Segoe UI") });
+            f.setPixelSize(16);
+            mb->setFont(f);
+        }
+    }
+
+    const QVariant raw = w->property("themeRole");
+    if (!raw.isValid()) return;
+    const Role role = parseRole(raw.toString());
+    w->setProperty(kRoleIdProp, int(role));
+
+    QPalette pal = w->palette();
+    switch (role) {
+    case RoleWindow:
+        pal.setColor(QPalette::Window, kWindowBg);
+        break;
+    case RoleTabs:
+        pal.setColor(QPalette::Window, kCardBg);
+        break;
+    case RoleConsole:
+        pal.setColor(QPalette::Base, kFieldBg);
+        break;
+    case RoleTitle:
+        pal.setColor(QPalette::ButtonText, Qt::white);
+        break;
+    case RoleMenu:
+        pal.setColor(QPalette::ButtonText, Qt::gray);
+        break;
+    case RoleField:
+        pal.setColor(QPalette::Base, kFieldBg);
+        pal.setColor(QPalette::Text, Qt::gray);
+        break;
+    case RoleReadout:
+        pal.setColor(QPalette::WindowText, kReadout);
+        break;
+    case RoleHint:
+        pal.setColor(QPalette::WindowText, Qt::gray);
+        break;
+    case RolePlaceholder:
+        pal.setColor(QPalette::Window, kCardBg);
+        pal.setColor(QPalette::Button, kCardBg);
+        break;
+    default:
+        return;
+    }
+    w->setPalette(pal);
+}
+
+// ===================== primitivas =====================
+void OsccbStyle::drawPrimitive(PrimitiveElement pe, const QStyleOption* opt,
+                               QPainter* p, const QWidget* w) const
+{
+    const Role role = roleOf(w);
+
+    switch (pe) {
+    case PE_PanelButtonCommand:
+        switch (role) {
+        case RoleTitle:
+            return; // transparente, sem borda
+        case RoleMenu: {
+            const bool checked = opt->state & State_On;
+            const bool pressed = opt->state & State_Sunken;
+            const QColor bg = checked ? kGreen : (pressed ? QColor("#cccccc") : QColor(Qt::black));
+            drawRounded(p, opt->rect, bg, checked ? kGreenLight : kGreen, checked ? 2 : 1, 6);
+            return;
+        }
+        case RoleAccent:
+            drawRounded(p, opt->rect, kGreen, QColor(), 0, 4);
+            return;
+        case RolePlaceholder:
+            p->fillRect(opt->rect, kCardBg);
+            return;
+        default:
+            break;
+        }
+        break;
+
+    case PE_PanelLineEdit:
+        if (role == RoleField) {
+            drawRounded(p, opt->rect, kFieldBg, kGrayBorder, 1, 4);
+            return;
+        }
+        break;
+
+    case PE_FrameTabWidget:
+        if (role == RoleTabs) {
+            p->fillRect(opt->rect, kCardBg);
+            return;
+        }
+        break;
+
+    default:
+        break;
+    }
+    QProxyStyle::drawPrimitive(pe, opt, p, w);
+}
+
+// ===================== controles =====================
+void OsccbStyle::drawControl(ControlElement ce, const QStyleOption* opt,
+                             QPainter* p, const QWidget* w) const
+{
+    const Role role = roleOf(w);
+
+    switch (ce) {
+    case CE_ShapedFrame:
+        switch (role) {
+        case RolePanel:     drawRounded(p, opt->rect, kWindowBg,    Qt::black,   1, 6);  return;
+        case RoleHighlight: drawRounded(p, opt->rect, kHighlightBg, kGreen,      1, 12); return;
+        case RoleConsole:   drawRounded(p, opt->rect, QColor(),     kGrayBorder, 1, 22); return;
+        default: break;
+        }
+        break;
+
+    case CE_PushButtonLabel:
+        if (role == RoleMenu && (opt->state & State_On)) {
+            // checked: texto branco
+            if (auto* b = qstyleoption_cast<const QStyleOptionButton*>(opt)) {
+                QStyleOptionButton o(*b);
+                o.palette.setColor(QPalette::ButtonText, Qt::white);
+                QProxyStyle::drawControl(ce, &o, p, w);
+                return;
+            }
+        }
+        break;
+
+    // ---- QProgressBar comum = meter ----
+    case CE_ProgressBarGroove:
+        if (role == RolePlaceholder) {
+            p->fillRect(opt->rect, kCardBg);
+            return;
+        }
+        drawRounded(p, opt->rect, kFieldBg, kMeterBorder, 1, 4);
+        return;
+
+    case CE_ProgressBarContents:
+        if (auto* pb = qstyleoption_cast<const QStyleOptionProgressBar*>(opt)) {
+            const qint64 range = qint64(pb->maximum) - pb->minimum;
+            if (range <= 0) return;
+            const double frac = qBound(0.0, double(qint64(pb->progress) - pb->minimum) / double(range), 1.0);
+            if (frac <= 0.0) return;
+
+            const QRectF inner = QRectF(pb->rect).adjusted(1, 1, -1, -1);
+            QRectF chunk = inner;
+            if (pb->state & State_Horizontal) {
+                chunk.setWidth(inner.width() * frac);
+            } else {
+                chunk.setTop(inner.bottom() - inner.height() * frac); // cresce de baixo p/ cima
+            }
+
+            QLinearGradient g(0, 0, 0, 1);
+            g.setCoordinateMode(QGradient::ObjectBoundingMode);
+            g.setColorAt(0.0, kMeterTop);
+            g.setColorAt(1.0, kMeterBottom);
+            p->fillRect(chunk, g);
+            return;
+        }
+        break;
+
+    default:
+        break;
+    }
+    QProxyStyle::drawControl(ce, opt, p, w);
+}
+
+void OsccbStyle::drawComplexControl(ComplexControl cc, const QStyleOptionComplex* opt,
+                                    QPainter* p, const QWidget* w) const
+{
+    // Cards (QGroupBox sem título): fundo + borda arredondada
+    if (cc == CC_GroupBox && roleOf(w) == RoleCard) {
+        drawRounded(p, opt->rect, kCardBg, Qt::black, 1, 6);
+        return;
+    }
+    QProxyStyle::drawComplexControl(cc, opt, p, w);
+}
+
+QSize OsccbStyle::sizeFromContents(ContentsType ct, const QStyleOption* opt,
+                                   const QSize& contentsSize, const QWidget* w) const
+{
+    QSize s = QProxyStyle::sizeFromContents(ct, opt, contentsSize, w);
+    // botões de menu: padding 10px 20px + borda
+    if (ct == CT_PushButton && roleOf(w) == RoleMenu)
+        s = s.expandedTo(contentsSize + QSize(2*20 + 2, 2*10 + 2));
+    return s;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <QProxyStyle>
+#include <QPalette>
+
+/*
+ * OsccbStyle — tema único do app (substitui os styleSheet por widget do .ui)
+ * - Base Fusion + paleta escura (antes montada no main.cpp)
+ * - Papel visual de cada widget vem da propriedade dinâmica "themeRole" do .ui
+ *   (window, tabs, card, panel, highlight, console, title, menu, accent,
+ *    field, readout, hint, placeholder); é resolvido uma vez no polish()
+ * - QProgressBar comum = meter vertical (gradiente)
+ * - ModernDial / ModernProgressBar recebem as cores pelas propriedades que já expõem,
+ *   uma vez e só se o widget não marcou "ownColors" (setters do ModernProgressBar marcam)
+ * - ModernButton checkable (mutes, cenas) sem tamanho no .ui: 16px, como no styleSheet antigo
+ */
+
+class OsccbStyle : public QProxyStyle {
+    Q_OBJECT
+public:
+    OsccbStyle();
+
+    QPalette standardPalette() const override;
+
+    using QProxyStyle::polish;
+    void polish(QPalette& pal) override;
+    void polish(QWidget* w) override;
+
+    void drawPrimitive(PrimitiveElement pe, const QStyleOption* opt,
+                       QPainter* p, const QWidget* w = nullptr) const override;
+    void drawControl(ControlElement ce, const QStyleOption* opt,
+                     QPainter* p, const QWidget* w = nullptr) const override;
+    void drawComplexControl(ComplexControl cc, const QStyleOptionComplex* opt,
+                            QPainter* p, const QWidget* w = nullptr) const override;
+    QSize sizeFromContents(ContentsType ct, const QStyleOption* opt,
+                           const QSize& contentsSize, const QWidget* w = nullptr) const override;
+
+    enum Role {
+        RoleNone = 0,
+        RoleWindow, RoleTabs, RoleCard, RolePanel, RoleHighlight, RoleConsole,
+        RoleTitle, RoleMenu, RoleAccent, RoleField, RoleReadout, RoleHint, RolePlaceholder
+    };
+
+private:
+    static Role roleOf(const QWidget* w);
+};
@@ -1,11 +1,15 @@
 #include "oscclient.h"
+#include "metrics.h"
+#include "trace.h"
 #include <QtEndian>
 #include <QDebug>
 #include <QNetworkInterface>
 #include <QEventLoop>
 #include <QElapsedTimer>
 #include <QRegularExpression>
+#include <cmath>
 #include <cstring>
+#include <utility>
 
 // ---- utils ----
 static inline QByteArray pad4(const QByteArray& in) {
@@ -22,14 +26,30 @@ static inline QString twoDigits(int n) {
 OscClient::OscClient(QObject* parent) : QObject(parent) {
     connect(&m_sock, &QUdpSocket::readyRead, this, &OscClient::onReadyRead);
     connect(&m_keepAlive, &QTimer::timeout, this, &OscClient::sendXRemote);
+
+    m_clock.start();
+    m_rttSweep.setInterval(RttTracker::kProbeIntervalMs);
+    connect(&m_rttSweep, &QTimer::timeout, this, &OscClient::sweepRtt);
+
+    m_replayTimer.setSingleShot(true);
+    m_replayTimer.setTimerType(Qt::PreciseTimer);
+    connect(&m_replayTimer, &QTimer::timeout, this, &OscClient::replayStep);
+
+    connect(this, &OscClient::oscMessageReceived, this, &OscClient::onSnapshotReply);
+    connect(this, &OscClient::oscMessageReceived, this, &OscClient::onInfoReply);
+}
+void OscClient::setTarget(const QHostAddress& addr, quint16 port) {
+    if (addr != m_addr) m_profile = &mixerProfile(MixerModel::Unknown);   // outro console: espera o /xinfo
+    m_addr = addr;
+    m_port = port;
 }
-void OscClient::setTarget(const QHostAddress& addr, quint16 port) { m_addr = addr; m_port = port; }
 QHostAddress OscClient::targetAddress() const { return m_addr; }
 quint16      OscClient::targetPort()   const { return m_port; }
 
 // ---- open/bind ----
 bool OscClient::open(quint16 localPort) {
-    if (m_sock.state() == QAbstractSocket::BoundState) return true;
+    if (m_io->state() == QAbstractSocket::BoundState) return true;
+    if (shared()) { emit error(QStringLiteral("Socket compartilhado não está aberto")); return false; }
     bool ok = m_sock.bind(QHostAddress::AnyIPv4, localPort, QUdpSocket::ShareAddress);
     if (!ok) emit error(QStringLiteral("Falha no bind UDP: %1").arg(m_sock.errorString()));
     return ok;
@@ -37,12 +57,20 @@ bool OscClient::open(quint16 localPort) {
 
 // ---- keepalive ----
 void OscClient::startFeedbackKeepAlive(int ms) {
+    if (shared()) {                       // pump() renova
+        if (m_keepAliveMs == 0) {
+            m_keepAliveMs   = ms;
+            m_lastXRemoteMs = m_clock.elapsed();
+            sendXRemote();
+        }
+        return;
+    }
     if (!m_keepAlive.isActive()) {
         m_keepAlive.start(ms);
         sendXRemote(); // dispara já
     }
 }
-void OscClient::stopFeedbackKeepAlive() { m_keepAlive.stop(); }
+void OscClient::stopFeedbackKeepAlive() { m_keepAlive.stop(); m_keepAliveMs = 0; }
 
 // --------- pack helpers ----------
 QByteArray OscClient::packString(const QString& s) {
@@ -62,55 +90,163 @@ QByteArray OscClient::packFloat(float v) {
     return QByteArray(reinterpret_cast<const char*>(&bits), 4);
 }
 
-// --------- send ----------
-bool OscClient::send(const QString& address, const QByteArray& typeTags, const QList<QByteArray>& args) {
-    if (m_addr.isNull()) { emit error("Endereço do mixer não configurado"); return false; }
-
+QByteArray OscClient::encode(const QString& address, const QByteArray& typeTags, const QList<QByteArray>& args) {
     QByteArray pkt;
     pkt += packString(address);
     pkt += packString("," + typeTags);  // typetags sempre iniciam com ','
 
     for (const auto& a : args)
         pkt += (a.size() % 4 == 0) ? a : pad4(a);
+    return pkt;
+}
+
+// --------- send ----------
+bool OscClient::send(const QString& address, const QByteArray& typeTags, const QList<QByteArray>& args) {
+    TRACE_SCOPE("osc.send");
+    if (m_addr.isNull()) { emit error("Endereço do mixer não configurado"); return false; }
+
+    const QByteArray pkt = encode(address, typeTags, args);
+    if (m_bundleDepth > 0) { m_bundle.append(pkt); return true; }   // sai no endBundle()
+    return writePacket(pkt);
+}
 
-    auto sent = m_sock.writeDatagram(pkt, m_addr, m_port);
+bool OscClient::writePacket(const QByteArray& pkt) {
+    qint64 sent;
+    {
+        TRACE_SCOPE("osc.writeDatagram");
+        sent = m_io->writeDatagram(pkt, m_addr, m_port);
+    }
     if (sent != pkt.size()) {
+        Metrics::add(Metrics::SendFailures);
         emit error(QStringLiteral("Envio OSC incompleto (%1/%2)").arg(sent).arg(pkt.size()));
         return false;
     }
+    Metrics::add(Metrics::DatagramsOut);
+    Metrics::add(Metrics::BytesOut, quint64(sent));
+    if (m_capture.isOpen()) m_capture.write(OscCaptureWriter::Tx, pkt, m_clock.nsecsElapsed());
+    emit datagramSent(pkt);
     return true;
 }
 
+bool OscClient::sendRaw(const QByteArray& msg) {
+    if (m_addr.isNull()) { emit error("Endereço do mixer não configurado"); return false; }
+    if (m_bundleDepth > 0) { m_bundle.append(msg); return true; }
+    return writePacket(msg);
+}
+
+// --------- bundle ----------
+void OscClient::beginBundle() {
+    ++m_bundleDepth;
+}
+
+bool OscClient::endBundle() {
+    if (m_bundleDepth == 0 || --m_bundleDepth > 0) return true;   // aninhado: o externo envia
+    const QList<QByteArray> msgs = std::exchange(m_bundle, {});
+    if (msgs.isEmpty()) return true;
+    if (msgs.size() == 1) return writePacket(msgs.first());        // sem overhead de bundle
+
+    TRACE_SCOPE("osc.sendBundle");
+    // "#bundle" + timetag 1 (imediato) + [tamanho u32 + mensagem]...
+    // Quebra em mais de um bundle se passar de kMaxBundleBytes (cabe num quadro Ethernet/Wi-Fi)
+    static const QByteArray head = QByteArray("#bundle", 8) + QByteArray(7, '\0') + QByteArray(1, '\1');
+    QByteArray pkt = head;
+    bool ok = true;
+    for (const QByteArray& m : msgs) {
+        if (pkt.size() > head.size() && pkt.size() + 4 + m.size() > kMaxBundleBytes) {
+            ok &= writePacket(pkt);
+            pkt = head;
+        }
+        pkt += packInt32(m.size());
+        pkt += m;
+    }
+    ok &= writePacket(pkt);
+    return ok;
+}
+
 void OscClient::sendXRemote() {
     send(QStringLiteral("/xremote"), QByteArray(), {});
 }
 
 void OscClient::queryName() { send(QStringLiteral("/xinfo"), QByteArray(), {}); }
 
+// Sets de fader/mute: cabeçalho pré-codificado do modelo + 4 bytes (sem montar string)
 void OscClient::setChannelMute(int ch, bool on) {
-    ch = qBound(1, ch, 32);
-    const QString path = QStringLiteral("/ch/%1/mix/on").arg(twoDigits(ch));
-    send(path, "i", { packInt32(on ? 1 : 0) });
+    const int i = qBound(1, ch, caps().channels) - 1;
+    const MixerAddresses& a = m_profile->addresses();
+    if (sendRaw(a.onHead[i] + packInt32(on ? 1 : 0))) trackSet(a.onPath[i], on ? 1 : 0);
 }
 void OscClient::setChannelFader(int ch, float v01) {
-    ch = qBound(1, ch, 32);
+    const int i = qBound(1, ch, caps().channels) - 1;
     v01 = qBound(0.0f, v01, 1.0f);
-    const QString path = QStringLiteral("/ch/%1/mix/fader").arg(twoDigits(ch));
-    send(path, "f", { packFloat(v01) });
+    const MixerAddresses& a = m_profile->addresses();
+    if (sendRaw(a.faderHead[i] + packFloat(v01))) trackSet(a.faderPath[i], v01);
 }
 void OscClient::setMainLRFader(float v01) {
     v01 = qBound(0.0f, v01, 1.0f);
-    send(QStringLiteral("/lr/mix/fader"), "f", { packFloat(v01) });
+    const MixerAddresses& a = m_profile->addresses();
+    if (sendRaw(a.lrFaderHead + packFloat(v01))) trackSet(a.lrFaderPath, v01);
 }
 void OscClient::setMainLRMute(bool on) {
-    send(QStringLiteral("/lr/mix/on"), "i", { packInt32(on ? 1 : 0) });
+    const MixerAddresses& a = m_profile->addresses();
+    if (sendRaw(a.lrOnHead + packInt32(on ? 1 : 0))) trackSet(a.lrOnPath, on ? 1 : 0);
+}
+void OscClient::getMainLRFader() { send(m_profile->addresses().lrFaderPath, "s", { packString("?") }); }
+void OscClient::getMainLRMute()  { send(m_profile->addresses().lrOnPath,    "s", { packString("?") }); }
+
+// --------- Latência (set -> eco/resposta) ----------
+void OscClient::trackSet(const QString& path, const QVariant& value) {
+    const qint64 now = m_clock.nsecsElapsed();
+    if (!m_rtt.onSent(path, now)) return;
+    // sonda: o GET garante uma resposta mesmo se o mixer não ecoar o nosso set
+    if (send(path, "s", { packString("?") })) m_probes.insert(path, Probe{ value, now });
+    if (!shared() && !m_rttSweep.isActive()) m_rttSweep.start();
+}
+void OscClient::matchReply(const QString& path) {
+    if (m_rtt.hasPending()) m_rtt.onReply(path, m_clock.nsecsElapsed());
+}
+// A resposta da sonda traz o valor que nós mesmos mandamos (já velho durante um
+// arrasto): não repassa, como antes da sonda existir. Só ela: a 1ª mensagem do
+// caminho depois da sonda consome a marca, e valor diferente (outro operador,
+// snapshot) segue para a UI. Fader: o console quantiza em 1024 passos.
+// Bancos de meter do modelo saem como "/meters/1" (canais) e "/meters/3" (LR);
+// os demais bancos e blobs fora do formato do modelo são descartados
+bool OscClient::routeMeters(const QString& path, bool hadBlob, const QByteArray& blob) {
+    if (!path.startsWith(QLatin1String("/meters/"))) return false;
+    if (hadBlob && path == QLatin1String(caps().meterChAddr) && m_profile->acceptChannelMeters(blob)) {
+        Metrics::add(Metrics::MeterFramesCh);
+        emit oscMessageReceived(QStringLiteral("/meters/1"), { blob });
+    } else if (hadBlob && path == QLatin1String(caps().meterLRAddr) && m_profile->acceptLRMeters(blob)) {
+        Metrics::add(Metrics::MeterFramesLR);
+        emit oscMessageReceived(QStringLiteral("/meters/3"), { blob });
+    } else {
+        Metrics::add(Metrics::Dropped);
+    }
+    return true;
 }
-void OscClient::getMainLRFader() {
-    const QString path = QStringLiteral("/lr/mix/fader");
-    send(path, "s", { packString("?") });
-    //send(QStringLiteral(""), "s", { packString("?") });
+
+bool OscClient::isProbeReply(const QString& path, const QVariantList& args) {
+    if (m_probes.isEmpty() || args.isEmpty()) return false;
+    const auto it = m_probes.constFind(path);
+    if (it == m_probes.constEnd()) return false;
+    const QVariant sent = it->value;
+    m_probes.erase(it);
+    if (sent.typeId() == QMetaType::Float)
+        return std::fabs(args.first().toFloat() - sent.toFloat()) <= 1.0f / 1024.0f;
+    return args.first().toInt() == sent.toInt();
+}
+void OscClient::sweepRtt() {
+    const qint64 now = m_clock.nsecsElapsed();
+    m_rtt.sweep(now);
+    for (auto it = m_probes.begin(); it != m_probes.end(); )   // sonda sem resposta
+        it = (now - it->sentNs >= qint64(RttTracker::kTimeoutMs) * 1000000) ? m_probes.erase(it) : std::next(it);
+    if (!m_rtt.hasPending()) m_rttSweep.stop();
+
+    const int p95Ms = int((m_rtt.recentP95Us() + 999) / 1000);
+    if (p95Ms != m_lastP95Ms) {
+        m_lastP95Ms = p95Ms;
+        emit latencyChanged(p95Ms);
+    }
 }
-void OscClient::getMainLRMute()  { send(QStringLiteral("/lr/mix/on"),    "s", { packString("?") }); }
 
 // --------- RX helpers ----------
 // CORRIGIDO: consome UM '\0' e alinha para múltiplo de 4
@@ -134,15 +270,9 @@ static bool readBlobPayload(const QByteArray& buf, int& i, QByteArray& out) {
     return true;
 }
 
-static inline bool isValidMetersBlob(const QByteArray& blob) {
-    return blob.size() >= 32 && (blob.size() % 2 == 0);
-}
-static inline bool isValidLRBlob(const QByteArray& blob) {
-    return blob.size() >= 4 && ((blob.size() % 2) == 0);
-}
-
 // Aceita tipos: i, f, s, T, F, b
 void OscClient::parseDatagram(const QByteArray& d) {
+    TRACE_SCOPE("osc.parseDatagram");
     int i = 0;
 
     // ---------- bundle ----------
@@ -151,13 +281,13 @@ void OscClient::parseDatagram(const QByteArray& d) {
         while (i + 4 <= d.size()) {
             quint32 beLen; std::memcpy(&beLen, d.constData()+i, 4); i += 4;
             const quint32 len = qFromBigEndian(beLen);
-            if (i + int(len) > d.size()) break;
+            if (i + int(len) > d.size()) { Metrics::add(Metrics::Malformed); break; }
 
             QByteArray elem = d.mid(i, int(len)); i += int(len);
 
             int j = 0;
             QString addr = readPaddedString(elem, j);
-            if (addr.isEmpty()) continue;
+            if (addr.isEmpty()) { Metrics::add(Metrics::Malformed); continue; }
             QString tags = readPaddedString(elem, j);
 
             QVariantList args;
@@ -189,27 +319,11 @@ void OscClient::parseDatagram(const QByteArray& d) {
                 }
             }
 
-            if (addr == "/meters/1") {
-                if (hadBlob && isValidMetersBlob(blob)) {
-                    args.clear(); args << blob;
-                    emit oscMessageReceived(addr, args);
-                } else {
-                    //qDebug() << "[RX bundle] /meters/1 ignorado (tags=" << tags << ", size=" << blob.size() << ")";
-                }
-                continue;
-            }
-
-            if (addr == "/meters/3") {
-                //qDebug() << "[RX bundle] /meters/3 tags=" << tags;
-                if (hadBlob && isValidLRBlob(blob)) {
-                    args.clear(); args << blob;
-                    emit oscMessageReceived(addr, args);
-                } else {
-                    //qDebug() << "[RX bundle] /meters/3 ignorado (tags=" << tags << ", size=" << blob.size() << ")";
-                }
-                continue;
-            }
+            if (routeMeters(addr, hadBlob, blob)) continue;
 
+            matchReply(addr);
+            if (isProbeReply(addr, args)) continue;
+            m_profile->canonical(addr);
             emit oscMessageReceived(addr, args);
         }
         return;
@@ -217,7 +331,7 @@ void OscClient::parseDatagram(const QByteArray& d) {
 
     // ---------- mensagem simples ----------
     QString address = readPaddedString(d, i);
-    if (address.isEmpty()) return;
+    if (address.isEmpty()) { Metrics::add(Metrics::Malformed); return; }
     QString tags = readPaddedString(d, i);
 
     QVariantList args;
@@ -249,47 +363,119 @@ void OscClient::parseDatagram(const QByteArray& d) {
         }
     }
 
-    if (address == "/meters/1") {
-        if (hadBlob && isValidMetersBlob(blob)) {
-            args.clear(); args << blob;
-            emit oscMessageReceived(address, args);
-        } else {
-            //qDebug() << "[RX msg] /meters/1 ignorado (tags=" << tags << ", size=" << blob.size() << ")";
-        }
-        return;
-    }
-
-    if (address == "/meters/3") {
-        //qDebug() << "[RX msg] /meters/3 tags=" << tags;
-        if (hadBlob && isValidLRBlob(blob)) {
-            args.clear(); args << blob;
-            emit oscMessageReceived(address, args);
-        } else {
-            //qDebug() << "[RX msg] /meters/3 ignorado (tags=" << tags << ", size=" << blob.size() << ")";
-        }
-        return;
-    }
+    if (routeMeters(address, hadBlob, blob)) return;
 
+    matchReply(address);
+    if (isProbeReply(address, args)) return;
+    m_profile->canonical(address);
     emit oscMessageReceived(address, args);
 }
 
 void OscClient::onReadyRead() {
+    TRACE_SCOPE("osc.onReadyRead");
     while (m_sock.hasPendingDatagrams()) {
         QByteArray d;
         d.resize(int(m_sock.pendingDatagramSize()));
         QHostAddress from; quint16 port;
-        m_sock.readDatagram(d.data(), d.size(), &from, &port);
+        const qint64 n = m_sock.readDatagram(d.data(), d.size(), &from, &port);
         Q_UNUSED(from)
         Q_UNUSED(port)
-        parseDatagram(d);
+        if (n < 0 || m_replaying) { Metrics::add(Metrics::Dropped); continue; }
+        ingest(d);
+    }
+}
+
+void OscClient::ingest(const QByteArray& d) {
+    Metrics::add(Metrics::DatagramsIn);
+    Metrics::add(Metrics::BytesIn, quint64(d.size()));
+    if (m_capture.isOpen()) m_capture.write(OscCaptureWriter::Rx, d, m_clock.nsecsElapsed());
+    emit datagramReceived(d);
+
+    // tempo de parse inclui os emits (slots diretos da UI rodam aqui dentro)
+    QElapsedTimer t; t.start();
+    parseDatagram(d);
+    Metrics::record(Metrics::ParseUs, quint32(t.nsecsElapsed() / 1000));
+}
+
+// ==============================
+// Captura / replay
+// ==============================
+bool OscClient::startRecording(const QString& path) {
+    if (!m_capture.open(path)) {
+        emit error(QStringLiteral("Falha ao abrir captura: %1").arg(path));
+        return false;
+    }
+    return true;
+}
+void OscClient::stopRecording() { m_capture.close(); }
+
+bool OscClient::startReplay(const QString& path, ReplayMode mode) {
+    stopReplay();
+    if (!m_replay.open(path)) {
+        emit error(QStringLiteral("Captura inválida: %1").arg(path));
+        return false;
     }
+    m_replaying     = true;
+    m_replayMode    = mode;
+    m_replayCount   = 0;
+    m_replayHasNext = m_replay.next(m_replayNext);
+    m_replayClock.start();
+    m_replayTimer.start(0);
+    return true;
+}
+
+void OscClient::stopReplay() {
+    m_replayTimer.stop();
+    m_replay.close();
+    m_replaying = m_replayHasNext = false;
+}
+
+// Tempo real: injeta tudo que já "venceu" e agenda o próximo.
+// Máxima velocidade: lotes de 256 por volta do event loop (timers da UI
+// continuam rodando, então meters/frames também entram na medição).
+void OscClient::replayStep() {
+    static constexpr int kFastBatch = 256;
+
+    int budget = kFastBatch;
+    while (m_replayHasNext) {
+        if (m_replayMode == ReplayMode::RealTime) {
+            const qint64 nowUs = m_replayClock.nsecsElapsed() / 1000;
+            if (m_replayNext.atUs > nowUs) {
+                m_replayTimer.start(int((m_replayNext.atUs - nowUs) / 1000));
+                return;
+            }
+        } else if (budget-- == 0) {
+            m_replayTimer.start(0);
+            return;
+        }
+
+        if (m_replayNext.dir == OscCaptureWriter::Rx) {
+            TRACE_SCOPE("osc.replay");
+            ingest(m_replayNext.datagram);
+            ++m_replayCount;
+        }
+        m_replayHasNext = m_replay.next(m_replayNext);
+    }
+
+    const qint64 elapsed = m_replayClock.elapsed();
+    const quint64 count = m_replayCount;
+    stopReplay();
+    emit replayFinished(count, elapsed);
 }
 
 // ==============================
 // Descoberta (broadcast/unicast)
 // ==============================
 
-QHostAddress OscClient::discoverMixer(int timeoutMs) {
+QString OscClient::discoveryReplyAddress(const QByteArray& d) {
+    int i = 0;
+    return readPaddedString(d, i);
+}
+
+// Portas sondadas na descoberta (X-Air e X32/M32)
+static constexpr quint16 kProbePorts[] = { kXAirPort, kX32Port };
+
+QHostAddress OscClient::discoverMixer(int timeoutMs, quint16* portOut) {
     QUdpSocket sock;
     if (!sock.bind(QHostAddress::AnyIPv4, 0, QUdpSocket::ShareAddress))
         return QHostAddress::Any;
@@ -301,7 +487,7 @@ QHostAddress OscClient::discoverMixer(int timeoutMs) {
     };
     const QByteArray probe = buildNoArg(QStringLiteral("/-prefs/name"));
 
-    sock.writeDatagram(probe, QHostAddress::Broadcast, 10024);
+    for (quint16 p : kProbePorts) sock.writeDatagram(probe, QHostAddress::Broadcast, p);
     for (const auto& ni : QNetworkInterface::allInterfaces()) {
         if (!(ni.flags() & QNetworkInterface::IsUp) ||
             !(ni.flags() & QNetworkInterface::IsRunning) ||
@@ -309,7 +495,7 @@ QHostAddress OscClient::discoverMixer(int timeoutMs) {
         for (const auto& e : ni.addressEntries()) {
             if (e.ip().protocol() != QAbstractSocket::IPv4Protocol) continue;
             if (!e.broadcast().isNull())
-                sock.writeDatagram(probe, e.broadcast(), 10024);
+                for (quint16 p : kProbePorts) sock.writeDatagram(probe, e.broadcast(), p);
         }
     }
 
@@ -321,16 +507,8 @@ QHostAddress OscClient::discoverMixer(int timeoutMs) {
             QByteArray d; d.resize(int(sock.pendingDatagramSize()));
             QHostAddress from; quint16 port;
             sock.readDatagram(d.data(), d.size(), &from, &port);
-            Q_UNUSED(port)
-            int idx = 0;
-            auto readStr = [](const QByteArray& buf, int& i)->QString{
-                int s = i; while (i < buf.size() && buf[i] != '\0') ++i;
-                QString r = QString::fromUtf8(buf.constData()+s, i-s);
-                if (i < buf.size()) ++i;
-                while (i % 4 != 0 && i < buf.size()) ++i;
-                return r;
-            };
-            if (readStr(d, idx) == "/-prefs/name" || idx==0 /*sanity*/) {
+            if (d.isEmpty() /*sanity*/ || discoveryReplyAddress(d) == "/-prefs/name") {
+                if (portOut) *portOut = port;
                 found = from; return found;
             }
         }
@@ -358,7 +536,7 @@ static QByteArray buildOscNoArg(const QString& address) {
     return pkt;
 }
 
-QHostAddress OscClient::discoverMixerRange(const QString& cidr, int timeoutMs) {
+QHostAddress OscClient::discoverMixerRange(const QString& cidr, int timeoutMs, quint16* portOut) {
     quint32 base; int prefix;
     if (!parseCidr(cidr, base, prefix)) {
         qWarning() << "CIDR inválido:" << cidr;
@@ -382,8 +560,10 @@ QHostAddress OscClient::discoverMixerRange(const QString& cidr, int timeoutMs) {
 
     for (quint32 ip = first; ip <= last; ++ip) {
         const QHostAddress dst = u32ToIp(ip);
-        sock.writeDatagram(probeXInfo, dst, 10024);
-        sock.writeDatagram(probeName,  dst, 10024);
+        for (quint16 p : kProbePorts) {
+            sock.writeDatagram(probeXInfo, dst, p);
+            sock.writeDatagram(probeName,  dst, p);
+        }
         if (ip == 0xFFFFFFFFu) break;
     }
 
@@ -395,19 +575,11 @@ QHostAddress OscClient::discoverMixerRange(const QString& cidr, int timeoutMs) {
                 QByteArray d; d.resize(int(sock.pendingDatagramSize()));
                 QHostAddress from; quint16 port;
                 sock.readDatagram(d.data(), d.size(), &from, &port);
-                Q_UNUSED(port)
-
-                int idx = 0;
-                auto readStr = [](const QByteArray& buf, int& i)->QString{
-                    int s = i; while (i < buf.size() && buf[i] != '\0') ++i;
-                    QString r = QString::fromUtf8(buf.constData()+s, i-s);
-                    if (i < buf.size()) ++i;
-                    while (i % 4 != 0 && i < buf.size()) ++i;
-                    return r;
-                };
-                QString addr = readStr(d, idx);
+
+                const QString addr = discoveryReplyAddress(d);
 
                 if (addr == "/xinfo" || addr == "/-prefs/name" || addr.startsWith("/ch/") || addr == "/xremote") {
+                    if (portOut) *portOut = port;
                     found = from; return found;
                 }
             }
@@ -416,7 +588,7 @@ QHostAddress OscClient::discoverMixerRange(const QString& cidr, int timeoutMs) {
     return QHostAddress();
 }
 
-QHostAddress OscClient::discoverOnAllIfaces(int timeoutMs) {
+QHostAddress OscClient::discoverOnAllIfaces(int timeoutMs, quint16* portOut) {
     const auto ifs = QNetworkInterface::allInterfaces();
     for (const auto& ni : ifs) {
         if (!(ni.flags() & QNetworkInterface::IsUp) ||
@@ -432,7 +604,7 @@ QHostAddress OscClient::discoverOnAllIfaces(int timeoutMs) {
             while (m & 0x80000000u) { ++prefix; m <<= 1; }
 
             QString cidr = QString("%1/%2").arg(e.ip().toString()).arg(prefix);
-            QHostAddress found = discoverMixerRange(cidr, timeoutMs);
+            QHostAddress found = discoverMixerRange(cidr, timeoutMs, portOut);
             if (!found.isNull()) return found;
         }
     }
@@ -440,29 +612,26 @@ QHostAddress OscClient::discoverOnAllIfaces(int timeoutMs) {
 }
 
 bool OscClient::setTargetFromDiscovery(const QString& cidrOrEmpty, int timeoutMs) {
+    quint16 port = kXAirPort;
     QHostAddress found = cidrOrEmpty.isEmpty()
-    ? discoverOnAllIfaces(timeoutMs)
-    : discoverMixerRange(cidrOrEmpty, timeoutMs);
+    ? discoverOnAllIfaces(timeoutMs, &port)
+    : discoverMixerRange(cidrOrEmpty, timeoutMs, &port);
 
     if (found.isNull()) return false;
-    setTarget(found, 10024);
+    setTarget(found, port);
     return true;
 }
 
 // --------- GET helpers / sync ---------
 void OscClient::getChannelFader(int ch) {
-    ch = qBound(1, ch, 32);
-    const QString path = QStringLiteral("/ch/%1/mix/fader").arg(twoDigits(ch));
-    send(path, "s", { packString("?") });
+    send(m_profile->addresses().faderPath[qBound(1, ch, caps().channels) - 1], "s", { packString("?") });
 }
 void OscClient::getChannelMute(int ch) {
-    ch = qBound(1, ch, 32);
-    const QString path = QStringLiteral("/ch/%1/mix/on").arg(twoDigits(ch));
-    send(path, "s", { packString("?") });
+    send(m_profile->addresses().onPath[qBound(1, ch, caps().channels) - 1], "s", { packString("?") });
 }
 void OscClient::syncAll(int channels) {
     startFeedbackKeepAlive(5000);
-    channels = qBound(1, channels, 32);
+    channels = qBound(1, channels, caps().channels);
     for (int ch = 1; ch <= channels; ++ch) {
         getChannelFader(ch);
         getChannelMute(ch);
@@ -471,20 +640,74 @@ void OscClient::syncAll(int channels) {
     getMainLRMute();
 }
 
+// --------- Snapshots (/-snap) ----------
+void OscClient::loadSnapshot(int slot) {
+    if (!caps().snapshots) return;
+    slot = qBound(1, slot, caps().snapshots);
+    send(QStringLiteral("/-snap/load"), "i", { packInt32(slot) });
+}
+void OscClient::saveSnapshot(int slot) {
+    if (!caps().snapshots) return;
+    slot = qBound(1, slot, caps().snapshots);
+    send(QStringLiteral("/-snap/save"), "i", { packInt32(slot) });
+}
+void OscClient::setSnapshotName(const QString& name) {
+    if (!caps().snapshots) return;
+    send(QStringLiteral("/-snap/name"), "s", { packString(name.left(15)) });   // nome curto no console
+}
+void OscClient::requestSnapshotNames(int slots) {
+    if (!caps().snapshots) return;
+    slots = qBound(1, slots, caps().snapshots);
+    beginBundle();
+    for (int n = 1; n <= slots; ++n)
+        send(QStringLiteral("/-snap/%1/name").arg(twoDigits(n)), "s", { packString("?") });
+    endBundle();
+}
+
+void OscClient::onSnapshotReply(const QString& address, const QVariantList& args) {
+    // "/-snap/NN/name" ,s
+    if (!address.startsWith(QLatin1String("/-snap/")) || !address.endsWith(QLatin1String("/name"))) return;
+    bool ok = false;
+    const int slot = address.mid(7, address.size() - 7 - 5).toInt(&ok);
+    if (!ok || slot < 1 || slot > kSnapshotSlots || args.isEmpty()) return;
+    emit snapshotName(slot, args.first().toString());
+}
+
+// --------- Modelo (/xinfo) ----------
+void OscClient::onInfoReply(const QString& address, const QVariantList& args) {
+    if (address != QLatin1String("/xinfo")) return;
+    setModel(mixerModelFromXinfo(args));
+}
+void OscClient::setModel(MixerModel m) {
+    const MixerProfile* p = &mixerProfile(m);
+    if (p == m_profile) return;
+    const bool banksChanged = qstrcmp(p->caps->meterLRAddr, m_profile->caps->meterLRAddr) != 0;
+    m_profile = p;
+    if (banksChanged) renewMeterSubscriptions();   // X32: LR vem em outro banco
+    emit modelChanged(m);
+}
+
 // --------- Meters subscribe helper ----------
 void OscClient::subscribeMetersAllChannels() {
     if (m_subMetersCh) return;
     m_subMetersCh = true;
-    send(QStringLiteral("/meters"), "si", { packString("/meters/1"), packInt32(0) });
+    m_lastRenewMs = m_clock.elapsed();
+    send(QStringLiteral("/meters"), "si", { packString(caps().meterChAddr), packInt32(0) });
 }
 void OscClient::subscribeMetersLR() {
     if (m_subMetersLR) return;
     m_subMetersLR = true;
-    send(QStringLiteral("/meters"), "si", { packString("/meters/3"), packInt32(0) });
+    m_lastRenewMs = m_clock.elapsed();
+    send(QStringLiteral("/meters"), "si", { packString(caps().meterLRAddr), packInt32(0) });
+}
+
+void OscClient::renewMeterSubscriptions() {
+    if (m_subMetersCh) send(QStringLiteral("/meters"), "si", { packString(caps().meterChAddr), packInt32(0) });
+    if (m_subMetersLR) send(QStringLiteral("/meters"), "si", { packString(caps().meterLRAddr), packInt32(0) });
 }
 
 bool OscClient::isOpen() const {
-    return m_sock.state() == QAbstractSocket::BoundState;
+    return m_io->state() == QAbstractSocket::BoundState;
 }
 void OscClient::close() {
 //     stopFeedbackKeepAlive();
@@ -493,9 +716,32 @@ void OscClient::close() {
 //     }
     stopFeedbackKeepAlive();
     m_subMetersCh = m_subMetersLR = false;
-    if (m_sock.state() == QAbstractSocket::BoundState) m_sock.close();
+    if (m_sock.state() == QAbstractSocket::BoundState) m_sock.close();   // o compartilhado é do hub
  }
 
+// --------- Sessão compartilhada ----------
+void OscClient::attachShared(QUdpSocket* sock) {
+    if (m_sock.state() == QAbstractSocket::BoundState) m_sock.close();
+    const bool keepAlive = m_keepAlive.isActive();
+    m_keepAlive.stop();
+    m_rttSweep.stop();
+    m_io = sock;
+    if (keepAlive) startFeedbackKeepAlive(m_keepAlive.interval());
+}
+
+void OscClient::pump() {
+    const qint64 now = m_clock.elapsed();
+    if (m_keepAliveMs > 0 && now - m_lastXRemoteMs >= m_keepAliveMs) {
+        m_lastXRemoteMs = now;
+        sendXRemote();
+    }
+    if ((m_subMetersCh || m_subMetersLR) && now - m_lastRenewMs >= kMeterRenewMs) {
+        m_lastRenewMs = now;
+        renewMeterSubscriptions();
+    }
+    if (m_rtt.hasPending()) sweepRtt();
+}
+
 void OscClient::requestStatDump() {
     // envia /-stat/dump sem args
     send(QStringLiteral("/-stat/dump"), QByteArray(), {});
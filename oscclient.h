@@ -5,6 +5,11 @@
 #include <QTimer>
 #include <QVariantList>
 #include <QRegularExpression>
+#include <QElapsedTimer>
+#include <QHash>
+#include "rtttracker.h"
+#include "osccapture.h"
+#include "mixermodel.h"
 
 class OscClient : public QObject {
     Q_OBJECT
@@ -12,11 +17,17 @@ public:
     explicit OscClient(QObject* parent=nullptr);
 
     // Alvo (IP/porta do mixer)
-    void setTarget(const QHostAddress& addr, quint16 port = 10024);
+    void setTarget(const QHostAddress& addr, quint16 port = kXAirPort);   // novo IP: modelo volta a Unknown
     QHostAddress targetAddress() const;
     quint16      targetPort()   const;
 
 
+    // ===== Modelo do console (ver mixermodel.h) =====
+    // Detectado na resposta do /xinfo; até lá Unknown (limites genéricos)
+    void setModel(MixerModel m);
+    const MixerProfile& profile() const { return *m_profile; }
+    const MixerCaps&    caps()    const { return *m_profile->caps; }
+
     // Abre/binda o socket local (porta 0 = efêmera)
     bool open(quint16 localPort = 0);
 
@@ -40,48 +51,145 @@ public:
     void getMainLRMute();             // "/lr/mix/on"      + "?"
 
 
+    // ===== Envio agrupado =====
+    // Entre beginBundle() e endBundle() os sets (e sondas de RTT) vão para um
+    // único bundle OSC, enviado no endBundle(); 1 mensagem só sai sem bundle.
+    void beginBundle();
+    bool endBundle();
+    // Mensagem já codificada (proxy, cabeçalhos do modelo); entra no bundle aberto
+    bool sendRaw(const QByteArray& msg);
+
+    // ===== Snapshots do console (/-snap) =====
+    // Recall inteiro em 1 datagrama, na velocidade interna do mixer
+    // Só X-Air (caps().snapshots); no X32/M32 as chamadas abaixo não mandam nada
+    static constexpr int kSnapshotSlots = 64;
+    void loadSnapshot(int slot);                 // "/-snap/load" ,i (1..64)
+    void saveSnapshot(int slot);                 // "/-snap/save" ,i (usa o nome de setSnapshotName)
+    void setSnapshotName(const QString& name);   // "/-snap/name" ,s
+    void requestSnapshotNames(int slots = kSnapshotSlots);   // GET "/-snap/NN/name" -> snapshotName()
+
     // Consulta “tudo” (ativa keepalive e pede fader/mute de 1..channels)
     void syncAll(int channels = 8);
 
-    // Descoberta automática
-    static QHostAddress discoverMixer(int timeoutMs = 2000);
-    QHostAddress discoverMixerRange(const QString& cidr, int timeoutMs = 1500);
-    QHostAddress discoverOnAllIfaces(int timeoutMs = 1500);
+    // Descoberta automática (sonda as portas X-Air e X32; *port = porta que respondeu)
+    static QHostAddress discoverMixer(int timeoutMs = 2000, quint16* port = nullptr);
+    QHostAddress discoverMixerRange(const QString& cidr, int timeoutMs = 1500, quint16* port = nullptr);
+    QHostAddress discoverOnAllIfaces(int timeoutMs = 1500, quint16* port = nullptr);
     bool setTargetFromDiscovery(const QString& cidrOrEmpty = QString(), int timeoutMs = 1500);
 
     // Helpers de empacotamento OSC
     static QByteArray packString(const QString& s);
+    static QByteArray packInt32(qint32 v);
+    static QByteArray packFloat(float v);
+    // Mensagem completa (endereço + ",tags" + args), como vai para o socket
+    static QByteArray encode(const QString& address, const QByteArray& typeTags, const QList<QByteArray>& args);
+
+    // Endereço OSC de uma resposta de descoberta ("" se não for OSC)
+    static QString discoveryReplyAddress(const QByteArray& d);
+
+    // Injeta um datagrama como se viesse do socket (replay, benchmarks)
+    void ingest(const QByteArray& d);   // métricas + captura + parse
 
     void subscribeMetersAllChannels();    // /meters/1 (ALL CHANNELS)
     void subscribeMetersLR();
+    void renewMeterSubscriptions();       // reenvia as assinaturas ativas (expiram no console)
 
     bool isOpen() const;
     void close();
+
+    // ===== Sessão compartilhada (MixerSessions) =====
+    // TX pelo socket do hub (RX chega por ingest()); sem timers próprios:
+    // keepalive, renovação de /meters e varredura de RTT saem de pump()
+    void attachShared(QUdpSocket* sock);
+    void pump();                          // tick único do hub
     void requestStatDump();
 
+    // Latência set -> eco/resposta por caminho (stats / export)
+    const RttTracker& rtt() const { return m_rtt; }
+
+    // ===== Captura / replay de tráfego (.osccap, ver osccapture.h) =====
+    bool startRecording(const QString& path);   // grava RX e TX até stopRecording()
+    void stopRecording();
+    bool isRecording() const { return m_capture.isOpen(); }
+
+    enum class ReplayMode { RealTime, AsFastAsPossible };
+    // Injeta os datagramas RX da captura no caminho de recepção (parse + sinais).
+    // Enquanto reproduz, o RX do socket é descartado (carga determinística).
+    bool startReplay(const QString& path, ReplayMode mode);
+    void stopReplay();
+    bool isReplaying() const { return m_replaying; }
+
 signals:
     void oscMessageReceived(QString address, QVariantList args);
     void error(QString message);
+    void latencyChanged(int p95Ms);   // p95 recente mudou (alimenta a taxa de envio)
+    void replayFinished(quint64 datagrams, qint64 elapsedMs);
+    void snapshotName(int slot, QString name);   // resposta de requestSnapshotNames (ou eco)
+    void modelChanged(MixerModel model);         // /xinfo identificou outro modelo
+    // Datagramas crus (proxy): recebido = antes do parse; enviado = após o write
+    void datagramReceived(const QByteArray& d);
+    void datagramSent(const QByteArray& d);
 
 private slots:
     void onReadyRead();
     void sendXRemote();
+    void sweepRtt();
+    void replayStep();
+    void onSnapshotReply(const QString& address, const QVariantList& args);
+    void onInfoReply(const QString& address, const QVariantList& args);
 
 private:
-    // Packing
-    static QByteArray packInt32(qint32 v);
-    static QByteArray packFloat(float v);
+    // Envio
     bool send(const QString& address, const QByteArray& typeTags, const QList<QByteArray>& args);
+    bool writePacket(const QByteArray& pkt);   // socket + métricas + captura
+
+    static constexpr int kMaxBundleBytes = 1400;
+    int               m_bundleDepth = 0;
+    QList<QByteArray> m_bundle;                // mensagens já codificadas
 
     // Parsing
     void parseDatagram(const QByteArray& d);
 
+    // Latência: marca o set e, se começou medição, manda o GET de sonda
+    void trackSet(const QString& path, const QVariant& value);
+    void matchReply(const QString& path);
+    bool isProbeReply(const QString& path, const QVariantList& args);   // true = não vai à UI
+    bool routeMeters(const QString& path, bool hadBlob, const QByteArray& blob); // true = era um banco /meters/N
+
     bool m_subMetersCh = false;
     bool m_subMetersLR = false;
 
+    // agendamento pelo hub (attachShared)
+    static constexpr int kMeterRenewMs = 8000;   // /meters expira em 10 s no console
+    bool   shared() const { return m_io != &m_sock; }
+    int    m_keepAliveMs   = 0;
+    qint64 m_lastXRemoteMs = 0;
+    qint64 m_lastRenewMs   = 0;
+
 private:
     QHostAddress m_addr{QHostAddress::Any};
-    quint16      m_port{10024};
+    quint16      m_port{kXAirPort};
+    const MixerProfile* m_profile = &mixerProfile(MixerModel::Unknown);
     QUdpSocket   m_sock;
+    QUdpSocket*  m_io = &m_sock;          // socket de envio (próprio ou do hub)
     QTimer       m_keepAlive;
+
+    RttTracker    m_rtt;
+    QElapsedTimer m_clock;
+    QTimer        m_rttSweep;
+    int           m_lastP95Ms = -1;
+
+    // sonda em voo: o valor do set que a resposta do GET deve trazer
+    struct Probe { QVariant value; qint64 sentNs; };
+    QHash<QString, Probe> m_probes;
+
+    OscCaptureWriter         m_capture;
+    OscCaptureReader         m_replay;
+    OscCaptureReader::Record m_replayNext;
+    bool          m_replaying = false;
+    bool          m_replayHasNext = false;
+    ReplayMode    m_replayMode = ReplayMode::RealTime;
+    QTimer        m_replayTimer;
+    QElapsedTimer m_replayClock;
+    quint64       m_replayCount = 0;
 };
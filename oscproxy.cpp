@@ -0,0 +1,221 @@
+#include "oscproxy.h"
+#include "oscclient.h"
+#include "logbuffer.h"
+#include "metrics.h"
+#include "trace.h"
+#include <QNetworkDatagram>
+#include <QtEndian>
+#include <cstring>
+
+// ---- utils ----
+static QString readStr(const QByteArray& buf, int& i) {
+    const int s = i;
+    while (i < buf.size() && buf[i] != '\0') ++i;
+    const QString r = QString::fromUtf8(buf.constData() + s, i - s);
+    if (i < buf.size()) ++i;
+    while (i % 4 != 0 && i < buf.size()) ++i;
+    return r;
+}
+
+// Chama fn(mensagem) para o datagrama ou para cada elemento de um #bundle
+template <typename Fn>
+static void forEachMessage(const QByteArray& d, Fn fn) {
+    if (!d.startsWith(QByteArray("#bundle\0", 8))) { fn(d); return; }
+    int i = 16;                                    // "#bundle\0" + timetag
+    while (i + 4 <= d.size()) {
+        quint32 be; std::memcpy(&be, d.constData() + i, 4); i += 4;
+        const int len = int(qFromBigEndian(be));
+        if (len <= 0 || i + len > d.size()) break;
+        fn(d.mid(i, len));
+        i += len;
+    }
+}
+
+static bool isGetMessage(const QByteArray& msg, int argsAt, const QString& tags) {
+    if (tags.isEmpty() || tags == QLatin1String(",")) return true;
+    if (tags != QLatin1String(",s")) return false;
+    return readStr(msg, argsAt) == QLatin1String("?");
+}
+
+QString OscProxy::peerKey(const QHostAddress& a, quint16 port) {
+    return a.toString() + ':' + QString::number(port);
+}
+
+OscProxy::OscProxy(OscClient* upstream, QObject* parent)
+    : QObject(parent), m_up(upstream)
+{
+    connect(&m_sock, &QUdpSocket::readyRead, this, &OscProxy::onReadyRead);
+    m_housekeeping.setInterval(1000);
+    connect(&m_housekeeping, &QTimer::timeout, this, &OscProxy::housekeeping);
+    m_clock.start();
+}
+
+bool OscProxy::start(quint16 port)
+{
+    if (isRunning()) return true;
+    if (!m_sock.bind(QHostAddress::AnyIPv4, port)) {
+        logError("proxy", QString("bind falhou na porta %1: %2").arg(port).arg(m_sock.errorString()));
+        return false;
+    }
+    connect(m_up, &OscClient::datagramReceived, this, &OscProxy::onUpstreamDatagram);
+    connect(m_up, &OscClient::datagramSent, this, [this](const QByteArray& d) {
+        // sets da UI deste host: o console não ecoa para quem mandou, então o proxy ecoa
+        if (m_forwarding) return;
+        forEachMessage(d, [this](const QByteArray& msg) {
+            int i = 0;
+            const QString addr = readStr(msg, i);
+            const QString tags = readStr(msg, i);
+            if (addr.isEmpty() || addr == QLatin1String("/xremote") || addr == QLatin1String("/meters")) return;
+            if (isGetMessage(msg, i, tags)) return;
+            m_mirror.insert(addr, msg);
+            fanOut(msg, nullptr);
+        });
+    });
+
+    m_up->startFeedbackKeepAlive(5000);
+    m_housekeeping.start();
+    logNotice("proxy", QString("Proxy OSC ouvindo na porta %1").arg(port));
+    return true;
+}
+
+void OscProxy::stop()
+{
+    if (!isRunning()) return;
+    disconnect(m_up, nullptr, this, nullptr);
+    m_housekeeping.stop();
+    m_sock.close();
+    m_peers.clear();
+    m_pendingGet.clear();
+    emit peersChanged(0);
+    logNotice("proxy", "Proxy OSC parado");
+}
+
+// ============ Clientes (downstream) ============
+void OscProxy::onReadyRead()
+{
+    const qint64 now = m_clock.elapsed();
+    while (m_sock.hasPendingDatagrams()) {
+        const QNetworkDatagram dg = m_sock.receiveDatagram();
+        const QByteArray d = dg.data();
+        if (d.isEmpty()) continue;
+
+        const QString key = peerKey(dg.senderAddress(), quint16(dg.senderPort()));
+        auto it = m_peers.find(key);
+        if (it == m_peers.end()) {
+            it = m_peers.insert(key, Peer{ dg.senderAddress(), quint16(dg.senderPort()) });
+            logInfo("proxy", "Cliente conectado: " + key);
+            emit peersChanged(int(m_peers.size()));
+        }
+        it->lastSeenMs = now;      // qualquer datagrama renova, como no console
+
+        TRACE_SCOPE("proxy.downstream");
+        // sets/GETs sem cache de um bundle sobem juntos, num bundle só
+        m_forwarding = true;
+        m_up->beginBundle();
+        forEachMessage(d, [&](const QByteArray& msg) { handleDownstream(msg, *it); });
+        m_up->endBundle();
+        m_forwarding = false;
+    }
+}
+
+void OscProxy::handleDownstream(const QByteArray& msg, Peer& from)
+{
+    int i = 0;
+    const QString addr = readStr(msg, i);
+    if (addr.isEmpty()) { Metrics::add(Metrics::Malformed); return; }
+    const QString tags = readStr(msg, i);
+
+    if (addr == QLatin1String("/xremote")) { from.xremote = true; return; }
+
+    if (addr == QLatin1String("/meters")) {
+        const QString which = tags.startsWith(QLatin1String(",s")) ? readStr(msg, i) : QString();
+        if (which == QLatin1String("/meters/1")) { from.meters1 = true; m_up->subscribeMetersAllChannels(); }
+        if (which == QLatin1String("/meters/3")) { from.meters3 = true; m_up->subscribeMetersLR(); }
+        return;
+    }
+
+    if (isGetMessage(msg, i, tags)) {
+        const auto cached = m_mirror.constFind(addr);
+        if (cached != m_mirror.constEnd()) { sendTo(from, *cached); return; }
+        // vários clientes podem pedir antes da resposta: todos a recebem
+        QStringList& who = m_pendingGet[addr];
+        const QString key = peerKey(from.addr, from.port);
+        if (!who.contains(key)) who.append(key);
+        m_up->sendRaw(msg);
+        return;
+    }
+
+    // set: sobe, vira estado, ecoa para os outros clientes e para a UI deste host
+    m_mirror.insert(addr, msg);
+    m_up->sendRaw(msg);
+    fanOut(msg, &from);
+    m_injecting = true;
+    m_up->ingest(msg);
+    m_injecting = false;
+}
+
+// ============ Console (upstream) ============
+void OscProxy::onUpstreamDatagram(const QByteArray& d)
+{
+    if (m_injecting) return;      // set de cliente reinjetado na UI deste host
+    TRACE_SCOPE("proxy.upstream");
+    forEachMessage(d, [this](const QByteArray& msg) { handleUpstreamMessage(msg); });
+}
+
+void OscProxy::handleUpstreamMessage(const QByteArray& msg)
+{
+    int i = 0;
+    const QString addr = readStr(msg, i);
+    if (addr.isEmpty()) return;
+
+    // meters: só para quem assinou (bytes do console, sem re-codificar)
+    const bool m1 = addr == QLatin1String("/meters/1");
+    if (m1 || addr == QLatin1String("/meters/3")) {
+        for (const Peer& p : std::as_const(m_peers))
+            if (m1 ? p.meters1 : p.meters3) sendTo(p, msg);
+        return;
+    }
+
+    m_mirror.insert(addr, msg);
+
+    // resposta de GET que subiu: volta para quem pediu; estado vai para todos em /xremote
+    const QStringList who = m_pendingGet.take(addr);
+    for (auto it = m_peers.cbegin(); it != m_peers.cend(); ++it)
+        if (it->xremote || who.contains(it.key())) sendTo(*it, msg);
+}
+
+// ============ Envio / manutenção ============
+void OscProxy::sendTo(const Peer& p, const QByteArray& pkt)
+{
+    if (m_sock.writeDatagram(pkt, p.addr, p.port) == pkt.size()) {
+        Metrics::add(Metrics::DatagramsOut);
+        Metrics::add(Metrics::BytesOut, quint64(pkt.size()));
+    } else {
+        Metrics::add(Metrics::SendFailures);
+    }
+}
+
+void OscProxy::fanOut(const QByteArray& pkt, const Peer* except)
+{
+    for (const Peer& p : std::as_const(m_peers)) {
+        if (!p.xremote || &p == except) continue;
+        sendTo(p, pkt);
+    }
+}
+
+void OscProxy::housekeeping()
+{
+    const qint64 now = m_clock.elapsed();
+
+    int expired = 0;
+    for (auto it = m_peers.begin(); it != m_peers.end(); ) {
+        if (now - it->lastSeenMs > kSubscriptionMs) {
+            logInfo("proxy", "Cliente expirou: " + it.key());
+            it = m_peers.erase(it);
+            ++expired;
+        } else {
+            ++it;
+        }
+    }
+    if (expired) emit peersChanged(int(m_peers.size()));
+}
@@ -0,0 +1,80 @@
+#pragma once
+#include <QObject>
+#include <QUdpSocket>
+#include <QHostAddress>
+#include <QHash>
+#include <QStringList>
+#include <QTimer>
+#include <QElapsedTimer>
+
+class OscClient;
+
+/*
+ * OscProxy — vários tablets numa única sessão com o console
+ * - O OscClient do app (upstream) é o único cliente /xremote do mixer:
+ *   keepalive, assinatura de meters e espelho do estado ficam só aqui
+ *   (a renovação de /meters é a do OscClient::pump da sessão)
+ * - Outras instâncias do app apontam para este host (porta kDefaultPort,
+ *   a mesma do mixer: basta trocar o IP) e falam OSC normalmente:
+ *     /xremote, /meters     -> assinatura local (não sobe)
+ *     GET com cache         -> respondido do espelho (não sobe)
+ *     GET sem cache, /xinfo -> sobe; a resposta volta para todos que pediram
+ *     set                   -> sobe, entra no espelho e é ecoado aos outros
+ * - Tudo que chega do console é repassado em bytes (sem re-codificar):
+ *   /meters/N só para quem assinou, o resto para todos em /xremote
+ * - Espelho: último datagrama por endereço (resposta pronta para um GET)
+ * Carga no console constante, independente de quantos operadores entram.
+ */
+
+class OscProxy : public QObject
+{
+    Q_OBJECT
+public:
+    static constexpr quint16 kDefaultPort    = 10024;
+    static constexpr int     kSubscriptionMs = 10000;   // como no console
+
+    OscProxy(OscClient* upstream, QObject* parent = nullptr);
+
+    bool start(quint16 port = kDefaultPort);
+    void stop();
+    bool isRunning() const { return m_sock.state() == QAbstractSocket::BoundState; }
+
+    int peerCount() const { return int(m_peers.size()); }
+
+signals:
+    void peersChanged(int count);
+
+private slots:
+    void onReadyRead();
+    void onUpstreamDatagram(const QByteArray& d);
+    void housekeeping();
+
+private:
+    struct Peer {
+        QHostAddress addr;
+        quint16      port = 0;
+        qint64       lastSeenMs = 0;
+        bool         xremote = false;
+        bool         meters1 = false;
+        bool         meters3 = false;
+    };
+
+    OscClient*    m_up;
+    QUdpSocket    m_sock;
+    QTimer        m_housekeeping;
+    QElapsedTimer m_clock;
+
+    QHash<QString, Peer>       m_peers;     // "ip:porta" -> cliente
+    QHash<QString, QByteArray> m_mirror;    // endereço -> último datagrama (mensagem simples)
+    QHash<QString, QStringList> m_pendingGet;// endereço -> clientes que pediram (sem cache)
+
+    bool   m_forwarding  = false;   // enviando em nome de um cliente (não ecoar de volta)
+    bool   m_injecting   = false;   // reinjetando set de cliente no OscClient local
+
+    void handleDownstream(const QByteArray& msg, Peer& from);
+    void handleUpstreamMessage(const QByteArray& msg);
+    void sendTo(const Peer& p, const QByteArray& pkt);
+    void fanOut(const QByteArray& pkt, const Peer* except);
+
+    static QString peerKey(const QHostAddress& a, quint16 port);
+};
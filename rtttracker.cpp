@@ -0,0 +1,91 @@
+#include "rtttracker.h"
+#include <algorithm>
+
+static constexpr qint64 kNsPerMs = 1000000;
+
+bool RttTracker::onSent(const QString& path, qint64 nowNs)
+{
+    if (m_pending.contains(path)) return false;   // mede a partir do 1º set não respondido
+
+    const auto it = m_lastProbe.constFind(path);
+    if (it != m_lastProbe.constEnd() && nowNs - it.value() < kProbeIntervalMs * kNsPerMs)
+        return false;
+
+    m_pending.insert(path, nowNs);
+    m_lastProbe.insert(path, nowNs);
+    return true;
+}
+
+void RttTracker::onReply(const QString& path, qint64 nowNs)
+{
+    const auto it = m_pending.find(path);
+    if (it == m_pending.end()) return;
+
+    const quint32 us = quint32(qBound<qint64>(0, (nowNs - it.value()) / 1000, 0xFFFFFFFFll));
+    m_pending.erase(it);
+
+    PathStats& ps = m_paths[path];
+    ps.hist[Metrics::bucketOf(us)]++;
+    ps.samples++;
+
+    m_recent[m_recentPos] = us;
+    m_recentPos = (m_recentPos + 1) % kRecent;
+    if (m_recentCount < kRecent) ++m_recentCount;
+
+    Metrics::add(Metrics::RttSamples);
+    Metrics::record(Metrics::RttUs, us);
+}
+
+int RttTracker::sweep(qint64 nowNs)
+{
+    int expired = 0;
+    for (auto it = m_pending.begin(); it != m_pending.end(); ) {
+        if (nowNs - it.value() >= kTimeoutMs * kNsPerMs) {
+            m_paths[it.key()].lost++;
+            Metrics::add(Metrics::RttLost);
+            it = m_pending.erase(it);
+            ++expired;
+        } else {
+            ++it;
+        }
+    }
+    return expired;
+}
+
+quint32 RttTracker::recentP95Us() const
+{
+    if (m_recentCount == 0) return 0;
+    quint32 tmp[kRecent];
+    std::copy(m_recent, m_recent + m_recentCount, tmp);
+    const int k = qMin(m_recentCount - 1, int(m_recentCount * 0.95));
+    std::nth_element(tmp, tmp + k, tmp + m_recentCount);
+    return tmp[k];
+}
+
+quint32 RttTracker::PathStats::percentile(double p) const
+{
+    if (samples == 0) return 0;
+    const quint64 rank = qMax<quint64>(1, quint64(p * double(samples) + 0.5));
+    quint64 acc = 0;
+    for (int b = 0; b < Metrics::kBuckets; ++b) {
+        acc += hist[b];
+        if (acc >= rank) return Metrics::bucketUpper(b);
+    }
+    return Metrics::bucketUpper(Metrics::kBuckets - 1);
+}
+
+QJsonObject RttTracker::toJson() const
+{
+    QJsonObject out;
+    for (auto it = m_paths.constBegin(); it != m_paths.constEnd(); ++it) {
+        const PathStats& ps = it.value();
+        QJsonObject o;
+        o.insert("samples", double(ps.samples));
+        o.insert("lost",    double(ps.lost));
+        o.insert("p50Us",   double(ps.percentile(0.50)));
+        o.insert("p95Us",   double(ps.percentile(0.95)));
+        o.insert("p99Us",   double(ps.percentile(0.99)));
+        out.insert(it.key(), o);
+    }
+    return out;
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include <QtGlobal>
+#include <QHash>
+#include <QString>
+#include <QJsonObject>
+#include "metrics.h"
+
+/*
+ * RttTracker — latência de ida e volta dos "sets" enviados ao mixer
+ * - onSent(): marca o instante do set; no máximo 1 medição em voo por caminho
+ *   e uma a cada kProbeIntervalMs (amostragem durante arrasto)
+ * - onReply(): o eco do /xremote ou a resposta do GET de sonda fecha a medição
+ * - sweep(): o que passar de kTimeoutMs sem resposta conta como perda
+ * - Histograma por caminho (mesmas faixas do Metrics) + janela recente (p95)
+ *   usada para adaptar a taxa de envio
+ * Só a thread do OscClient usa (sem sincronização).
+ */
+
+class RttTracker
+{
+public:
+    static constexpr int kProbeIntervalMs = 250;
+    static constexpr int kTimeoutMs       = 1000;
+    static constexpr int kRecent          = 32;   // amostras da janela recente
+
+    struct PathStats {
+        quint64 hist[Metrics::kBuckets]{};
+        quint64 samples = 0;
+        quint64 lost    = 0;
+
+        quint32 percentile(double p) const;   // µs
+    };
+
+    // true = a medição começou agora; o chamador deve mandar o GET de sonda
+    bool onSent(const QString& path, qint64 nowNs);
+    void onReply(const QString& path, qint64 nowNs);
+    int  sweep(qint64 nowNs);                 // devolve quantas expiraram
+
+    bool    hasPending() const { return !m_pending.isEmpty(); }
+    quint32 recentP95Us() const;
+
+    const QHash<QString, PathStats>& paths() const { return m_paths; }
+    QJsonObject toJson() const;
+
+private:
+    QHash<QString, qint64>    m_pending;     // caminho -> instante do set (ns)
+    QHash<QString, qint64>    m_lastProbe;   // caminho -> início da última medição (ns)
+    QHash<QString, PathStats> m_paths;
+
+    quint32 m_recent[kRecent]{};
+    int     m_recentCount = 0;
+    int     m_recentPos   = 0;
+};
@@ -0,0 +1,56 @@
+#include "scenemorph.h"
+#include "trace.h"
+
+SceneMorph::SceneMorph(QObject* parent)
+    : QObject(parent)
+{
+    m_timer.setTimerType(Qt::PreciseTimer);
+    m_timer.setInterval(kTickMs);
+    connect(&m_timer, &QTimer::timeout, this, &SceneMorph::tick);
+}
+
+void SceneMorph::start(const QVector<float>& from, const QVector<float>& to, int durationMs)
+{
+    m_timer.stop();
+    m_from = from;
+    m_to   = to;
+    m_cur  = from;
+    for (int i = 0; i < m_to.size(); ++i)
+        if (m_to[i] < 0.0f) m_to[i] = (i < m_from.size()) ? m_from[i] : 0.0f;
+    m_from.resize(m_to.size());
+    m_cur.resize(m_to.size());
+
+    m_durationMs = durationMs;
+    if (durationMs <= 0) {
+        emit frame(m_to);
+        emit finished();
+        return;
+    }
+    m_clock.start();
+    m_timer.start();
+}
+
+void SceneMorph::stop()
+{
+    if (!m_timer.isActive()) return;
+    m_timer.stop();
+    emit cancelled();
+}
+
+void SceneMorph::tick()
+{
+    TRACE_SCOPE("scene.morphTick");
+    const double t = qMin(1.0, double(m_clock.elapsed()) / m_durationMs);
+    const float  k = float(t * t * (3.0 - 2.0 * t));     // smoothstep: sem tranco no início/fim
+
+    for (int i = 0; i < m_to.size(); ++i)
+        m_cur[i] = m_from[i] + (m_to[i] - m_from[i]) * k;
+
+    if (t >= 1.0) {
+        m_timer.stop();
+        emit frame(m_to);          // último passo exato (sem resíduo de float)
+        emit finished();
+        return;
+    }
+    emit frame(m_cur);
+}
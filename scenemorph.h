@@ -0,0 +1,44 @@
+#pragma once
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QVector>
+
+/*
+ * SceneMorph — transição temporizada (crossfade) entre cenas
+ * - Interpola posições de fader 0..1 (o domínio da lei de fader do mixer,
+ *   o mesmo float de /ch/NN/mix/fader), com curva suave (smoothstep)
+ * - Taxa fixa (kTickMs ~30 Hz): cada frame() traz TODOS os parâmetros do
+ *   passo; quem recebe envia num bundle só (dedupe no caminho de envio)
+ * - Alvo < 0 = parâmetro fora da cena: fica parado no valor de origem
+ * - Duração <= 0: um frame com o alvo e finished() na hora
+ * - stop() no meio da transição emite cancelled(): o que ficou para o fim
+ *   (mutes da cena) ainda precisa ser aplicado por quem ouve
+ */
+
+class SceneMorph : public QObject
+{
+    Q_OBJECT
+public:
+    static constexpr int kTickMs = 33;
+
+    explicit SceneMorph(QObject* parent = nullptr);
+
+    void start(const QVector<float>& from, const QVector<float>& to, int durationMs);
+    void stop();                 // em andamento -> cancelled()
+    bool isRunning() const { return m_timer.isActive(); }
+
+signals:
+    void frame(const QVector<float>& values);
+    void finished();
+    void cancelled();
+
+private slots:
+    void tick();
+
+private:
+    QTimer        m_timer;
+    QElapsedTimer m_clock;
+    QVector<float> m_from, m_to, m_cur;
+    int           m_durationMs = 0;
+};
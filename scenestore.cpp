@@ -0,0 +1,143 @@
+#include "scenestore.h"
+#include "logbuffer.h"
+#include "trace.h"
+#include <QSettings>
+#include <QSaveFile>
+#include <QFile>
+#include <QMutexLocker>
+
+SceneStore::SceneStore(const QString& iniPath, QObject* parent)
+    : QObject(parent), m_path(iniPath)
+{
+    load();
+
+    m_writeDelay.setSingleShot(true);
+    m_writeDelay.setInterval(kWriteDelayMs);
+    connect(&m_writeDelay, &QTimer::timeout, this, &SceneStore::handOff);
+
+    m_thread.setObjectName(QStringLiteral("SceneStore"));
+    m_writer.moveToThread(&m_thread);
+    m_thread.start(QThread::LowPriority);
+}
+
+SceneStore::~SceneStore()
+{
+    m_thread.quit();
+    m_thread.wait();
+
+    // thread parada: o que ainda estiver pendente é gravado aqui mesmo
+    if (m_writeDelay.isActive()) { m_writeDelay.stop(); handOff(); }
+    writePending();
+}
+
+// ============ Leitura ============
+void SceneStore::load()
+{
+    TRACE_SCOPE("scenes.load");
+    QSettings s(m_path, QSettings::IniFormat);
+    s.setFallbacksEnabled(false);
+
+    const QStringList keys = s.allKeys();   // "GRUPO/chave" ou "chave"
+    for (const QString& k : keys) {
+        const int slash = k.indexOf('/');
+        const QString group = slash < 0 ? QString() : k.left(slash);
+        m_groups[group].insert(k.mid(slash + 1), s.value(k));
+    }
+    logInfo("scenes", QString("%1 grupos carregados de %2").arg(m_groups.size()).arg(m_path));
+}
+
+QVariant SceneStore::value(const QString& group, const QString& key, const QVariant& def) const
+{
+    const auto g = m_groups.constFind(group);
+    if (g == m_groups.cend()) return def;
+    return g->value(key, def);
+}
+
+// ============ Escrita (write-behind) ============
+void SceneStore::setValue(const QString& group, const QString& key, const QVariant& v)
+{
+    QVariantMap& g = m_groups[group];
+    const auto it = g.constFind(key);
+    if (it != g.cend() && *it == v) return;   // nada mudou: nem agenda escrita
+    g.insert(key, v);
+    scheduleWrite();
+}
+
+void SceneStore::setGroup(const QString& group, const QVariantMap& values)
+{
+    const auto it = m_groups.constFind(group);
+    if (it != m_groups.cend() && *it == values) return;
+    m_groups.insert(group, values);
+    scheduleWrite();
+}
+
+void SceneStore::scheduleWrite()
+{
+    // 1ª mudança arma o timer; as seguintes da mesma rajada só entram na cópia
+    if (!m_writeDelay.isActive()) m_writeDelay.start();
+}
+
+void SceneStore::flush()
+{
+    if (m_writeDelay.isActive()) { m_writeDelay.stop(); handOff(); }
+    QMetaObject::invokeMethod(&m_writer, [this]{ writePending(); }, Qt::BlockingQueuedConnection);
+}
+
+void SceneStore::handOff()
+{
+    bool wake = false;
+    {
+        QMutexLocker lock(&m_pendingMutex);
+        m_pending    = m_groups;        // cópia implícita (COW): barata na GUI
+        m_hasPending = true;
+        if (!m_writeQueued) { m_writeQueued = true; wake = true; }
+    }
+    // escrita ainda na fila pega a cópia mais nova; não precisa enfileirar outra
+    if (wake) QMetaObject::invokeMethod(&m_writer, [this]{ writePending(); }, Qt::QueuedConnection);
+}
+
+void SceneStore::writePending()
+{
+    Groups snapshot;
+    {
+        QMutexLocker lock(&m_pendingMutex);
+        m_writeQueued = false;
+        if (!m_hasPending) return;
+        snapshot.swap(m_pending);
+        m_hasPending = false;
+    }
+
+    TRACE_SCOPE("scenes.write");
+    if (!writeIni(m_path, snapshot))
+        logWarning("scenes", QString("Falha ao gravar %1").arg(m_path));
+}
+
+bool SceneStore::writeIni(const QString& path, const Groups& groups)
+{
+    // QSettings monta o INI (mesmo formato/escape de sempre) num temporário...
+    const QString tmpPath = path + ".tmp";
+    QFile::remove(tmpPath);
+    {
+        QSettings s(tmpPath, QSettings::IniFormat);
+        s.setFallbacksEnabled(false);
+        for (auto g = groups.cbegin(); g != groups.cend(); ++g) {
+            if (!g.key().isEmpty()) s.beginGroup(g.key());
+            for (auto it = g->cbegin(); it != g->cend(); ++it) s.setValue(it.key(), it.value());
+            if (!g.key().isEmpty()) s.endGroup();
+        }
+        s.sync();
+        if (s.status() != QSettings::NoError) return false;
+    }
+
+    QFile tmp(tmpPath);
+    if (!tmp.open(QIODevice::ReadOnly)) return false;
+    const QByteArray bytes = tmp.readAll();
+    tmp.close();
+    tmp.remove();
+
+    // ...e QSaveFile publica (temp + rename): leitor nunca vê INI pela metade
+    QSaveFile out(path);
+    if (!out.open(QIODevice::WriteOnly)) return false;
+    out.write(bytes);
+    return out.commit();
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <QObject>
+#include <QHash>
+#include <QMutex>
+#include <QString>
+#include <QThread>
+#include <QTimer>
+#include <QVariant>
+#include <QVariantMap>
+
+/*
+ * SceneStore — profiles.ini em memória, com gravação em segundo plano
+ * - Carrega o INI uma vez (construtor); leituras (cenas, labels) só na memória
+ * - setValue()/setGroup() marcam sujo; após kWriteDelayMs a GUI tira uma cópia
+ *   e uma thread própria grava: rajadas de edição viram uma escrita só
+ * - Gravação atômica: INI montado num .tmp (QSettings, mesmo formato de
+ *   sempre) e publicado com QSaveFile (arquivo temporário + rename)
+ * - flush() grava na hora e espera (fechamento do app)
+ * Grupos/chaves como no QSettings: "LABELS"/"lbl_1", "INICIO"/"m0", ...
+ * Só a thread da GUI chama a API pública.
+ */
+
+class SceneStore : public QObject
+{
+    Q_OBJECT
+public:
+    static constexpr int kWriteDelayMs = 400;
+
+    explicit SceneStore(const QString& iniPath, QObject* parent = nullptr);
+    ~SceneStore() override;
+
+    bool        hasGroup(const QString& group) const { return m_groups.contains(group); }
+    QVariantMap group(const QString& group) const    { return m_groups.value(group); }
+    QStringList groups() const                       { return m_groups.keys(); }
+    QVariant    value(const QString& group, const QString& key,
+                      const QVariant& def = QVariant()) const;
+
+    void setValue(const QString& group, const QString& key, const QVariant& v);
+    void setGroup(const QString& group, const QVariantMap& values);   // substitui o grupo
+
+    void flush();
+
+private:
+    using Groups = QHash<QString, QVariantMap>;
+
+    QString m_path;
+    Groups  m_groups;          // "" = chaves fora de grupo ([General])
+    QTimer  m_writeDelay;
+
+    // Lado da thread de escrita
+    QThread m_thread;
+    QObject m_writer;          // vive em m_thread; recebe as escritas enfileiradas
+    QMutex  m_pendingMutex;
+    Groups  m_pending;         // última cópia ainda não gravada
+    bool    m_hasPending   = false;
+    bool    m_writeQueued  = false;
+
+    void load();
+    void scheduleWrite();
+    void handOff();            // GUI: copia o estado e acorda a thread
+    void writePending();       // thread de escrita
+    static bool writeIni(const QString& path, const Groups& groups);
+};
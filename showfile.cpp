@@ -0,0 +1,223 @@
+#include "showfile.h"
+#include "scenestore.h"
+#include "trace.h"
+#include <QSaveFile>
+#include <QVariantMap>
+#include <QStringList>
+#include <cstring>
+
+static constexpr char kMagic[8] = { 'O','S','C','S','H','O','W','\0' };
+
+static inline quint32 align8(quint32 v) { return (v + 7u) & ~7u; }
+
+// QString -> campo char[N] (UTF-8, sempre terminado em '\0')
+template <int N>
+static void putName(char (&dst)[N], const QString& s)
+{
+    std::memset(dst, 0, N);
+    QByteArray u = s.toUtf8();
+    if (u.size() > N - 1) u.truncate(N - 1);
+    std::memcpy(dst, u.constData(), size_t(u.size()));
+}
+
+template <int N>
+static QString getName(const char (&src)[N])
+{
+    return QString::fromUtf8(src, int(qstrnlen(src, N)));
+}
+
+// ============ CRC32 (polinômio do zlib) ============
+quint32 ShowFile::crc32(const uchar* data, qint64 len)
+{
+    static const auto table = [] {
+        struct T { quint32 v[256]; } t{};
+        for (quint32 i = 0; i < 256; ++i) {
+            quint32 c = i;
+            for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : (c >> 1);
+            t.v[i] = c;
+        }
+        return t;
+    }();
+
+    quint32 c = 0xFFFFFFFFu;
+    for (qint64 i = 0; i < len; ++i) c = table.v[(c ^ data[i]) & 0xFF] ^ (c >> 8);
+    return c ^ 0xFFFFFFFFu;
+}
+
+// ============ Leitura (mmap) ============
+bool ShowFile::fail(QString* error, const QString& why)
+{
+    if (error) *error = why;
+    close();
+    return false;
+}
+
+bool ShowFile::open(const QString& path, QString* error)
+{
+    TRACE_SCOPE("show.open");
+    close();
+#if Q_BYTE_ORDER != Q_LITTLE_ENDIAN
+    return fail(error, QStringLiteral("Formato .oscshow exige host little-endian"));
+#endif
+
+    m_file.setFileName(path);
+    if (!m_file.open(QIODevice::ReadOnly)) return fail(error, m_file.errorString());
+    m_size = m_file.size();
+    if (m_size < qint64(sizeof(ShowHeader))) return fail(error, QStringLiteral("Arquivo curto demais"));
+
+    m_base = m_file.map(0, m_size);
+    if (!m_base) {
+        m_fallback = m_file.readAll();
+        if (m_fallback.size() != m_size) return fail(error, m_file.errorString());
+        m_base = reinterpret_cast<const uchar*>(m_fallback.constData());
+    }
+
+    const auto* h = reinterpret_cast<const ShowHeader*>(m_base);
+    if (std::memcmp(h->magic, kMagic, sizeof(kMagic)) != 0)
+        return fail(error, QStringLiteral("Não é um arquivo de show"));
+    if (h->version != kVersion)
+        return fail(error, QStringLiteral("Versão de show não suportada (%1)").arg(h->version));
+    if (h->fileSize != quint64(m_size))
+        return fail(error, QStringLiteral("Tamanho não confere (arquivo truncado?)"));
+    if (crc32(m_base + sizeof(ShowHeader), m_size - qint64(sizeof(ShowHeader))) != h->crc32)
+        return fail(error, QStringLiteral("CRC não confere"));
+
+    const quint64 tableEnd = sizeof(ShowHeader) + quint64(h->sectionCount) * sizeof(ShowSection);
+    if (tableEnd > quint64(m_size)) return fail(error, QStringLiteral("Tabela de seções inválida"));
+
+    const auto* sec = reinterpret_cast<const ShowSection*>(m_base + sizeof(ShowHeader));
+    for (int i = 0; i < h->sectionCount; ++i) {
+        const ShowSection& s = sec[i];
+        if ((s.offset & 7u) || quint64(s.offset) + s.size > quint64(m_size))
+            return fail(error, QStringLiteral("Seção fora do arquivo"));
+
+        auto take = [&](Span& span, quint32 recSize) {
+            if (quint64(s.count) * recSize > s.size) return false;
+            span.offset = s.offset;
+            span.count  = int(s.count);
+            return true;
+        };
+        bool ok = true;
+        switch (s.type) {
+        case Labels:   ok = take(m_labels,   sizeof(ShowLabel));   break;
+        case Scenes:   ok = take(m_scenes,   sizeof(ShowScene));   break;
+        case Params:   ok = take(m_params,   sizeof(ShowParam));   break;
+        default: break;   // seção de versão futura: ignorada
+        }
+        if (!ok) return fail(error, QStringLiteral("Seção com registros a mais"));
+    }
+    return true;
+}
+
+void ShowFile::close()
+{
+    if (m_base && m_fallback.isEmpty()) m_file.unmap(const_cast<uchar*>(m_base));
+    m_base = nullptr;
+    m_size = 0;
+    m_fallback.clear();
+    m_file.close();
+    m_labels = m_scenes = m_params = Span();
+}
+
+int ShowFile::sceneIndex(const QString& name) const
+{
+    for (int i = 0; i < sceneCount(); ++i)
+        if (getName(scene(i).name) == name) return i;
+    return -1;
+}
+
+// ============ INI (SceneStore) <-> show ============
+void ShowFile::importInto(SceneStore& store) const
+{
+    QVariantMap labels;
+    for (int i = 0; i < labelCount(); ++i)
+        labels.insert(getName(label(i).key), getName(label(i).text));
+    store.setGroup("LABELS", labels);
+
+    for (int i = 0; i < sceneCount(); ++i) {
+        const ShowScene& sc = scene(i);
+        QVariantMap g;
+        for (int ch = 0; ch < kShowMaxChannels; ++ch) {
+            if (sc.mute[ch] != 0xFF)  g.insert(QString("m%1").arg(ch), sc.mute[ch] != 0);
+            if (sc.fader[ch] >= 0.0f) g.insert(QString("f%1").arg(ch), sc.fader[ch]);
+        }
+        if (sc.muteLR != 0xFF)  g.insert("mLR", sc.muteLR != 0);
+        if (sc.faderLR >= 0.0f) g.insert("fLR", sc.faderLR);
+        if (sc.snapSlot > 0)    g.insert("snap", sc.snapSlot);
+        if (sc.fadeMs >= 0)     g.insert("fadeMs", sc.fadeMs);
+        store.setGroup(getName(sc.name), g);
+    }
+}
+
+bool ShowFile::exportStore(const SceneStore& store, const QList<ShowParam>& params,
+                           const QString& path, QString* error)
+{
+    TRACE_SCOPE("show.export");
+
+    // ---- registros ----
+    QList<ShowLabel> labels;
+    const QVariantMap lbl = store.group("LABELS");
+    for (auto it = lbl.cbegin(); it != lbl.cend(); ++it) {
+        ShowLabel l;
+        putName(l.key, it.key());
+        putName(l.text, it.value().toString());
+        labels.append(l);
+    }
+
+    QList<ShowScene> scenes;
+    QStringList groups = store.groups();
+    groups.sort();
+    for (const QString& name : std::as_const(groups)) {
+        if (name.isEmpty() || name == "LABELS" || name == "CONFIG") continue;
+        const QVariantMap g = store.group(name);
+        ShowScene sc;
+        std::memset(&sc, 0, sizeof(sc));
+        putName(sc.name, name);
+        sc.snapSlot = g.value("snap", 0).toInt();
+        sc.fadeMs   = g.contains("fadeMs") ? g.value("fadeMs").toInt() : -1;
+        for (int ch = 0; ch < kShowMaxChannels; ++ch) {
+            const QVariant m = g.value(QString("m%1").arg(ch));
+            const QVariant f = g.value(QString("f%1").arg(ch));
+            sc.mute[ch]  = m.isValid() ? quint8(m.toBool() ? 1 : 0) : quint8(0xFF);
+            sc.fader[ch] = f.isValid() ? qBound(0.0f, f.toFloat(), 1.0f) : -1.0f;
+        }
+        sc.muteLR  = g.contains("mLR") ? quint8(g.value("mLR").toBool() ? 1 : 0) : quint8(0xFF);
+        sc.faderLR = g.contains("fLR") ? qBound(0.0f, g.value("fLR").toFloat(), 1.0f) : -1.0f;
+        scenes.append(sc);
+    }
+
+    // ---- montagem: cabeçalho, tabela, seções alinhadas ----
+    struct Part { quint32 type; const void* data; quint32 recSize; int count; };
+    const Part parts[] = {
+        { Labels,   labels.constData(), sizeof(ShowLabel),   int(labels.size()) },
+        { Scenes,   scenes.constData(), sizeof(ShowScene),   int(scenes.size()) },
+        { Params,   params.constData(), sizeof(ShowParam),   int(params.size()) },
+    };
+    const int nParts = int(sizeof(parts) / sizeof(parts[0]));
+
+    QByteArray out(int(align8(sizeof(ShowHeader) + nParts * sizeof(ShowSection))), '\0');
+    QList<ShowSection> table;
+    for (const Part& p : parts) {
+        const quint32 bytes = p.recSize * quint32(p.count);
+        table.append(ShowSection{ p.type, quint32(out.size()), bytes, quint32(p.count) });
+        out.append(static_cast<const char*>(p.data), int(bytes));
+        out.append(QByteArray(int(align8(quint32(out.size())) - quint32(out.size())), '\0'));
+    }
+    std::memcpy(out.data() + sizeof(ShowHeader), table.constData(), size_t(nParts) * sizeof(ShowSection));
+
+    ShowHeader h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, kMagic, sizeof(kMagic));
+    h.version      = kVersion;
+    h.sectionCount = quint16(nParts);
+    h.fileSize     = quint32(out.size());
+    h.crc32        = crc32(reinterpret_cast<const uchar*>(out.constData()) + sizeof(ShowHeader),
+                           out.size() - qint64(sizeof(ShowHeader)));
+    std::memcpy(out.data(), &h, sizeof(h));
+
+    QSaveFile f(path);
+    if (!f.open(QIODevice::WriteOnly)) { if (error) *error = f.errorString(); return false; }
+    f.write(out);
+    if (!f.commit()) { if (error) *error = f.errorString(); return false; }
+    return true;
+}
@@ -0,0 +1,119 @@
+#pragma once
+#include <QtGlobal>
+#include <QFile>
+#include <QList>
+#include <QString>
+
+class SceneStore;
+
+/*
+ * Show (.oscshow) — arquivo binário versionado com cenas, labels e um retrato
+ * dos parâmetros do mixer (reaplicado no console ao abrir)
+ *
+ * Formato (little-endian, seções alinhadas em 8):
+ *   ShowHeader   "OSCSHOW\0" u16 versão u16 nº de seções u32 tamanho u32 crc32 ...
+ *   ShowSection  [nº de seções]  tipo / offset / tamanho / nº de registros
+ *   seções       vetores de registros de tamanho fixo (ShowLabel, ShowScene, ...)
+ * - crc32 (zlib) cobre tudo depois do cabeçalho
+ * - Leitura: QFile::map + ponteiros direto nos registros, sem parse; a única
+ *   passada no arquivo é a conferência do CRC na abertura
+ * - Valores "ausentes" numa cena: mute 0xFF, fader < 0, fadeMs < 0 (usa o padrão)
+ * Importa/exporta do SceneStore (profiles.ini: LABELS, cenas INICIO/ORACAO/...).
+ * Seções de tipo desconhecido são ignoradas (inclusive o "CHNT" de layout de
+ * canais gravado pelas primeiras versões: a UI não remapeia strips).
+ */
+
+static constexpr int kShowMaxChannels = 32;
+static constexpr int kShowNameLen     = 16;
+
+struct ShowHeader {
+    char    magic[8];          // "OSCSHOW\0"
+    quint16 version;
+    quint16 sectionCount;
+    quint32 fileSize;
+    quint32 crc32;             // de sizeof(ShowHeader) até fileSize
+    quint32 reserved[3];
+};
+
+struct ShowSection {
+    quint32 type;              // ShowFile::SectionType
+    quint32 offset;            // desde o início do arquivo
+    quint32 size;              // bytes
+    quint32 count;             // registros
+};
+
+struct ShowLabel {
+    char key[kShowNameLen];    // labelKey do botão de título
+    char text[48];             // UTF-8, terminado em '\0'
+};
+
+struct ShowScene {
+    char    name[kShowNameLen];            // INICIO, ORACAO, ...
+    qint32  snapSlot;                      // 0 = local; 1..64 = snapshot do console
+    qint32  fadeMs;                        // < 0 = padrão do app
+    quint8  mute[kShowMaxChannels];        // 1 = mudo, 0 = aberto, 0xFF = fora da cena
+    float   fader[kShowMaxChannels];       // 0..1; < 0 = fora da cena
+    quint8  muteLR;
+    quint8  pad[3];
+    float   faderLR;
+};
+
+struct ShowParam {
+    char    path[32];          // endereço OSC ("/ch/01/mix/fader")
+    quint32 type;              // 'i' ou 'f'
+    quint32 bits;              // int32 ou float (bits)
+};
+
+static_assert(sizeof(ShowHeader)  == 32,  "layout do .oscshow");
+static_assert(sizeof(ShowSection) == 16,  "layout do .oscshow");
+static_assert(sizeof(ShowLabel)   == 64,  "layout do .oscshow");
+static_assert(sizeof(ShowScene)   == 192, "layout do .oscshow");
+static_assert(sizeof(ShowParam)   == 40,  "layout do .oscshow");
+
+class ShowFile
+{
+public:
+    static constexpr quint16 kVersion = 1;
+
+    enum SectionType : quint32 {
+        Labels   = 0x534C424C,   // "LBLS"
+        Scenes   = 0x534E4353,   // "SCNS"
+        Params   = 0x4D524150,   // "PARM"
+    };
+
+    ShowFile() = default;
+    ~ShowFile() { close(); }
+    ShowFile(const ShowFile&) = delete;
+    ShowFile& operator=(const ShowFile&) = delete;
+
+    bool open(const QString& path, QString* error = nullptr);
+    void close();
+    bool isOpen() const { return m_base != nullptr; }
+
+    int labelCount()   const { return m_labels.count; }
+    int sceneCount()   const { return m_scenes.count; }
+    int paramCount()   const { return m_params.count; }
+
+    const ShowLabel&   label(int i)   const { return reinterpret_cast<const ShowLabel*>(m_base + m_labels.offset)[i]; }
+    const ShowScene&   scene(int i)   const { return reinterpret_cast<const ShowScene*>(m_base + m_scenes.offset)[i]; }
+    const ShowParam&   param(int i)   const { return reinterpret_cast<const ShowParam*>(m_base + m_params.offset)[i]; }
+    int sceneIndex(const QString& name) const;   // -1 se não existe
+
+    // SceneStore (INI) <-> show
+    void importInto(SceneStore& store) const;
+    static bool exportStore(const SceneStore& store, const QList<ShowParam>& params,
+                            const QString& path, QString* error = nullptr);
+
+    static quint32 crc32(const uchar* data, qint64 len);
+
+private:
+    struct Span { quint32 offset = 0; int count = 0; };
+
+    QFile        m_file;
+    QByteArray   m_fallback;     // sem mmap (ex.: content:// no Android): cópia em memória
+    const uchar* m_base = nullptr;
+    qint64       m_size = 0;
+    Span m_labels, m_scenes, m_params;
+
+    bool fail(QString* error, const QString& why);
+};
@@ -0,0 +1,185 @@
+#include "stateexport.h"
+#include "oscclient.h"
+#include "logbuffer.h"
+#include "trace.h"
+#include <QDateTime>
+#include <QDir>
+#include <QStandardPaths>
+#include <QtEndian>
+#include <cstddef>
+#include <cstring>
+
+// ---- utils (TX: mensagem simples ou #bundle, como no OscProxy) ----
+static QString readStr(const QByteArray& buf, int& i) {
+    const int s = i;
+    while (i < buf.size() && buf[i] != '\0') ++i;
+    const QString r = QString::fromUtf8(buf.constData() + s, i - s);
+    if (i < buf.size()) ++i;
+    while (i % 4 != 0 && i < buf.size()) ++i;
+    return r;
+}
+
+template <typename Fn>
+static void forEachMessage(const QByteArray& d, Fn fn) {
+    if (!d.startsWith(QByteArray("#bundle\0", 8))) { fn(d); return; }
+    int i = 16;                                    // "#bundle\0" + timetag
+    while (i + 4 <= d.size()) {
+        quint32 be; std::memcpy(&be, d.constData() + i, 4); i += 4;
+        const int len = int(qFromBigEndian(be));
+        if (len <= 0 || i + len > d.size()) break;
+        fn(d.mid(i, len));
+        i += len;
+    }
+}
+
+StateExport::StateExport(QObject* parent)
+    : QObject(parent)
+{
+}
+
+StateExport::~StateExport()
+{
+    stop();
+}
+
+QString StateExport::defaultPath()
+{
+#ifdef Q_OS_LINUX
+    if (QDir(QStringLiteral("/dev/shm")).exists()) return QStringLiteral(OSCCB_SHM_DEFAULT_PATH);
+#endif
+    const QString dir = QStandardPaths::writableLocation(QStandardPaths::RuntimeLocation);
+    QDir().mkpath(dir);
+    return dir + "/osccb-state";
+}
+
+bool StateExport::start(OscClient* osc, const QString& path)
+{
+    stop();
+
+    m_file.setFileName(path);
+    if (!m_file.open(QIODevice::ReadWrite) || !m_file.resize(sizeof(osccb_shm_state))) {
+        logError("shm", QString("Não foi possível criar %1: %2").arg(path, m_file.errorString()));
+        m_file.close();
+        return false;
+    }
+    uchar* map = m_file.map(0, sizeof(osccb_shm_state));
+    if (!map) {
+        logError("shm", QString("mmap falhou em %1: %2").arg(path, m_file.errorString()));
+        m_file.close();
+        return false;
+    }
+    m_shm = reinterpret_cast<osccb_shm_state*>(map);
+
+    // estado inicial: tudo "desconhecido"; seq ímpar até o cabeçalho ficar pronto
+    __atomic_store_n(&m_shm->seq, 1u, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    const quint32 seq = 1;
+    std::memset(reinterpret_cast<char*>(m_shm) + offsetof(osccb_shm_state, pad0), 0,
+                sizeof(osccb_shm_state) - offsetof(osccb_shm_state, pad0));
+    m_shm->magic    = OSCCB_SHM_MAGIC;
+    m_shm->version  = OSCCB_SHM_VERSION;
+    m_shm->size     = sizeof(osccb_shm_state);
+    m_shm->channels = OSCCB_SHM_MAX_CH;
+    for (int i = 0; i < OSCCB_SHM_MAX_CH; ++i) { m_shm->fader[i] = -1.0f; m_shm->on[i] = -1; }
+    m_shm->lr_fader = -1.0f;
+    m_shm->lr_on    = -1;
+    __atomic_store_n(&m_shm->seq, seq + 1, __ATOMIC_RELEASE);
+
+    m_osc = osc;
+    connect(m_osc, &OscClient::oscMessageReceived, this, &StateExport::onMessage);
+    connect(m_osc, &OscClient::datagramSent,       this, &StateExport::onSent);
+    logNotice("shm", "Estado exportado em " + path);
+    return true;
+}
+
+void StateExport::stop()
+{
+    if (m_osc) disconnect(m_osc, nullptr, this, nullptr);
+    m_osc = nullptr;
+    if (m_shm) m_file.unmap(reinterpret_cast<uchar*>(m_shm));
+    m_shm = nullptr;
+    m_file.close();
+}
+
+// ============ Seqlock (1 escritor) ============
+void StateExport::beginWrite()
+{
+    const quint32 s = __atomic_load_n(&m_shm->seq, __ATOMIC_RELAXED);
+    __atomic_store_n(&m_shm->seq, s + 1, __ATOMIC_RELAXED);    // ímpar: leitores descartam
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+void StateExport::endWrite(bool meters)
+{
+    const qint64 now = QDateTime::currentMSecsSinceEpoch();
+    ++m_shm->updates;
+    m_shm->wall_ms = now;
+    if (meters) m_shm->meter_wall_ms = now;
+    const quint32 s = __atomic_load_n(&m_shm->seq, __ATOMIC_RELAXED);
+    __atomic_store_n(&m_shm->seq, s + 1, __ATOMIC_RELEASE);    // par: cópia consistente
+}
+
+// ============ Sets enviados por este app ============
+// só ",f"/",i" de 1 argumento (fader/on); GETs (",s ?") e o resto ficam de fora
+void StateExport::onSent(const QByteArray& datagram)
+{
+    if (!m_shm) return;
+    forEachMessage(datagram, [this](const QByteArray& msg) {
+        int i = 0;
+        QString addr = readStr(msg, i);
+        const QString tags = readStr(msg, i);
+        if (addr.isEmpty() || i + 4 > msg.size()) return;
+        if (tags != QLatin1String(",f") && tags != QLatin1String(",i")) return;
+
+        quint32 be; std::memcpy(&be, msg.constData() + i, 4);
+        const quint32 bits = qFromBigEndian(be);
+        QVariantList args;
+        if (tags == QLatin1String(",f")) { float f; std::memcpy(&f, &bits, 4); args << f; }
+        else                             args << qint32(bits);
+        m_osc->profile().canonical(addr);     // X32: /main/st -> /lr, como no RX
+        onMessage(addr, args);
+    });
+}
+
+// ============ Mensagens do mixer ============
+// /ch/NN/mix/fader|on, /lr/mix/fader|on, /meters/1, /meters/3
+void StateExport::onMessage(const QString& address, const QVariantList& args)
+{
+    if (!m_shm || args.isEmpty()) return;
+
+    if (address.startsWith(QLatin1String("/meters/"))) {
+        const bool ch = address == QLatin1String("/meters/1");
+        if (!ch && address != QLatin1String("/meters/3")) return;
+        TRACE_SCOPE("shm.meters");
+        const QByteArray raw = args.first().toByteArray();
+        beginWrite();
+        const MixerProfile& prof = m_osc->profile();    // X32: floats LE, LR no /meters/2
+        if (ch) m_shm->meter_count = quint32(prof.allMetersDb256(raw, m_shm->meter_db256, OSCCB_SHM_MAX_METERS));
+        else    prof.lrMetersDb256(raw, m_shm->lr_db256);
+        endWrite(true);
+        return;
+    }
+
+    const bool isFader = address.endsWith(QLatin1String("/mix/fader"));
+    const bool isOn    = address.endsWith(QLatin1String("/mix/on"));
+    if (!isFader && !isOn) return;
+
+    float*   fader = nullptr;
+    qint32*  on    = nullptr;
+    if (address.startsWith(QLatin1String("/lr/"))) {
+        fader = &m_shm->lr_fader;
+        on    = &m_shm->lr_on;
+    } else if (address.startsWith(QLatin1String("/ch/"))) {
+        const int ch = QStringView(address).mid(4, 2).toInt();
+        if (ch < 1 || ch > OSCCB_SHM_MAX_CH) return;
+        fader = &m_shm->fader[ch - 1];
+        on    = &m_shm->on[ch - 1];
+    } else {
+        return;
+    }
+
+    beginWrite();
+    if (isFader) *fader = args.first().toFloat();
+    else         *on    = args.first().toInt() ? 1 : 0;
+    endWrite(false);
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <QObject>
+#include <QFile>
+#include <QString>
+#include <QVariantList>
+#include "osccb_shm.h"
+
+class OscClient;
+
+/*
+ * StateExport — publica fader/mute/LR e meters num segmento mapeado
+ * (layout e leitura: osccb_shm.h), para overlays e monitores locais
+ * - Escreve direto no mapeamento a cada mensagem do mixer; sem cópia extra
+ * - Também publica os sets que este app envia (datagramSent): o console não
+ *   ecoa para quem mandou, então sem isso o segmento ficaria com o valor velho
+ * - Seqlock: seq ímpar durante a escrita, par ao terminar (1 escritor)
+ * - Linux: /dev/shm (memória, sem I/O); outros: diretório de runtime
+ */
+
+class StateExport : public QObject
+{
+    Q_OBJECT
+public:
+    explicit StateExport(QObject* parent = nullptr);
+    ~StateExport() override;
+
+    static QString defaultPath();
+
+    bool start(OscClient* osc, const QString& path = defaultPath());
+    void stop();
+    bool isRunning() const { return m_shm != nullptr; }
+
+private slots:
+    void onMessage(const QString& address, const QVariantList& args);
+    void onSent(const QByteArray& datagram);
+
+private:
+    QFile            m_file;
+    osccb_shm_state* m_shm = nullptr;
+    OscClient*       m_osc = nullptr;
+
+    void beginWrite();
+    void endWrite(bool meters);
+};
@@ -0,0 +1,192 @@
+#include "statspanel.h"
+#include "logbuffer.h"
+#include "rtttracker.h"
+#include "trace.h"
+#include "oscclient.h"
+#include <QPlainTextEdit>
+#include <QPushButton>
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QFontDatabase>
+#include <QJsonDocument>
+#include <QStandardPaths>
+#include <QDateTime>
+#include <QFile>
+#include <QDir>
+
+StatsPanel::StatsPanel(QWidget* parent)
+    : QWidget(parent)
+{
+    m_text = new QPlainTextEdit(this);
+    m_text->setReadOnly(true);
+    m_text->setLineWrapMode(QPlainTextEdit::NoWrap);
+    m_text->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    m_text->setProperty("themeRole", "console");
+
+    m_dump = new QPushButton(tr("Salvar JSON"), this);
+    m_dump->setProperty("themeRole", "menu");
+    m_dump->setMinimumSize(100, 35);
+    connect(m_dump, &QPushButton::clicked, this, &StatsPanel::dumpJson);
+
+    m_trace = new QPushButton(tr("Gravar trace"), this);
+    m_trace->setProperty("themeRole", "menu");
+    m_trace->setMinimumSize(100, 35);
+    m_trace->setCheckable(true);
+    m_trace->setChecked(Trace::enabled());   // pode ter vindo ligado por OSCCB_TRACE
+    connect(m_trace, &QPushButton::toggled, this, &StatsPanel::toggleTrace);
+
+    m_capture = new QPushButton(tr("Gravar OSC"), this);
+    m_capture->setProperty("themeRole", "menu");
+    m_capture->setMinimumSize(100, 35);
+    m_capture->setCheckable(true);
+    m_capture->setEnabled(false);            // habilita com setOscClient()
+    connect(m_capture, &QPushButton::toggled, this, &StatsPanel::toggleCapture);
+
+    auto* buttons = new QHBoxLayout;
+    buttons->addStretch(1);
+    buttons->addWidget(m_capture);
+    buttons->addWidget(m_trace);
+    buttons->addWidget(m_dump);
+
+    auto* lay = new QVBoxLayout(this);
+    lay->addWidget(m_text, 1);
+    lay->addLayout(buttons);
+
+    m_timer.setInterval(1000);
+    connect(&m_timer, &QTimer::timeout, this, &StatsPanel::refresh);
+
+    m_prev = Metrics::snapshot();
+}
+
+void StatsPanel::setOscClient(OscClient* osc)
+{
+    m_osc = osc;
+    m_rtt = osc ? &osc->rtt() : nullptr;
+    m_capture->setEnabled(osc != nullptr);
+    if (osc) {
+        QSignalBlocker block(m_capture);
+        m_capture->setChecked(osc->isRecording());   // pode ter vindo de --record
+    }
+}
+
+void StatsPanel::showEvent(QShowEvent* e)
+{
+    QWidget::showEvent(e);
+    m_prev = Metrics::snapshot();   // janela recomeça ao voltar para a aba
+    m_timer.start();
+}
+
+void StatsPanel::hideEvent(QHideEvent* e)
+{
+    m_timer.stop();
+    QWidget::hideEvent(e);
+}
+
+// µs -> "x.xx ms"
+static QString ms(quint32 us) { return QString::number(us / 1000.0, 'f', 2); }
+
+void StatsPanel::refresh()
+{
+    const Metrics::Snapshot now = Metrics::snapshot();
+    const Metrics::Snapshot w   = now.since(m_prev);
+    m_prev = now;
+
+    const double secs = qMax<qint64>(1, w.msecs) / 1000.0;
+    auto rate = [&](Metrics::Counter c) { return QString::number(w.counters[c] / secs, 'f', 1); };
+    auto line = [](const QString& label, const QString& a, const QString& b = QString(), const QString& c = QString()) {
+        return label.leftJustified(22) + a.rightJustified(10) + b.rightJustified(10) + c.rightJustified(10) + '\n';
+    };
+    auto hist = [&](const QString& label, Metrics::Histogram h) {
+        return line(label, ms(w.percentile(h, 0.50)), ms(w.percentile(h, 0.95)), ms(w.percentile(h, 0.99)));
+    };
+
+    QString t;
+    t += line("Rede (por s)", "entrada", "saída");
+    t += line("  datagramas", rate(Metrics::DatagramsIn), rate(Metrics::DatagramsOut));
+    t += line("  kB", QString::number(w.counters[Metrics::BytesIn]  / secs / 1024.0, 'f', 1),
+                      QString::number(w.counters[Metrics::BytesOut] / secs / 1024.0, 'f', 1));
+    t += '\n';
+    t += line("Meters (frames/s)", "canais", "LR");
+    t += line("", rate(Metrics::MeterFramesCh), rate(Metrics::MeterFramesLR));
+    t += '\n';
+    t += line("Tempos (ms)", "p50", "p95", "p99");
+    t += hist("  parse/datagrama", Metrics::ParseUs);
+    t += hist("  frame da UI", Metrics::UiFrameUs);
+    t += hist("  atraso timer meters", Metrics::TimerLateUs);
+    t += line("  frames UI/s", rate(Metrics::UiFrames));
+    t += hist("  ida e volta (set)", Metrics::RttUs);
+    t += '\n';
+    t += line("Desde a partida", "total");
+    t += line("  malformados", QString::number(now.counters[Metrics::Malformed]));
+    t += line("  descartados", QString::number(now.counters[Metrics::Dropped]));
+    t += line("  falhas de envio", QString::number(now.counters[Metrics::SendFailures]));
+    t += line("  sets sem resposta", QString::number(now.counters[Metrics::RttLost]));
+
+    if (m_rtt && !m_rtt->paths().isEmpty()) {
+        t += '\n';
+        t += line("Ida e volta (ms)", "p50", "p95", "perdas");
+        QStringList keys = m_rtt->paths().keys();
+        keys.sort();
+        for (const QString& k : std::as_const(keys)) {
+            const RttTracker::PathStats& ps = m_rtt->paths().value(k);
+            t += line("  " + k, ms(ps.percentile(0.50)), ms(ps.percentile(0.95)), QString::number(ps.lost));
+        }
+    }
+
+    m_text->setPlainText(t);
+}
+
+void StatsPanel::dumpJson()
+{
+    const QString dir = QStandardPaths::writableLocation(QStandardPaths::DocumentsLocation);
+    QDir().mkpath(dir);
+    const QString path = dir + "/osccb-metrics-" + QDateTime::currentDateTime().toString("yyyyMMdd-hhmmss") + ".json";
+
+    QJsonObject json = Metrics::toJson(Metrics::snapshot());
+    if (m_rtt) json.insert("rtt", m_rtt->toJson());
+
+    QFile f(path);
+    if (!f.open(QIODevice::WriteOnly) ||
+        f.write(QJsonDocument(json).toJson()) < 0) {
+        logError("stats", "Falha ao salvar métricas em " + path);
+        return;
+    }
+    logNotice("stats", "Métricas salvas em " + path);
+}
+
+void StatsPanel::toggleTrace(bool on)
+{
+    if (on) {
+        Trace::setEnabled(true);
+        logInfo("trace", "Gravação de trace ligada");
+        return;
+    }
+
+    const QString dir = QStandardPaths::writableLocation(QStandardPaths::DocumentsLocation);
+    QDir().mkpath(dir);
+    const QString path = dir + "/osccb-trace-" + QDateTime::currentDateTime().toString("yyyyMMdd-hhmmss") + ".json";
+
+    if (Trace::writeChromeJson(path)) logNotice("trace", "Trace salvo em " + path);
+    else                              logError("trace", "Falha ao salvar trace em " + path);
+}
+
+void StatsPanel::toggleCapture(bool on)
+{
+    if (!m_osc) return;
+    if (!on) {
+        m_osc->stopRecording();
+        logNotice("capture", "Captura de OSC encerrada");
+        return;
+    }
+
+    const QString dir = QStandardPaths::writableLocation(QStandardPaths::DocumentsLocation);
+    QDir().mkpath(dir);
+    const QString path = dir + "/osccb-capture-" + QDateTime::currentDateTime().toString("yyyyMMdd-hhmmss") + ".osccap";
+
+    if (m_osc->startRecording(path)) {
+        logNotice("capture", "Gravando OSC em " + path);
+    } else {
+        QSignalBlocker block(m_capture);
+        m_capture->setChecked(false);
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <QWidget>
+#include <QTimer>
+#include "metrics.h"
+
+class QPlainTextEdit;
+class RttTracker;
+class OscClient;
+class QPushButton;
+
+/*
+ * StatsPanel — métricas ao vivo (aba Config)
+ * - Atualiza 1x/s e só enquanto visível (timer parado no hideEvent)
+ * - Taxas e percentis são da última janela (diferença entre snapshots);
+ *   totais de erros desde a partida
+ * - "Salvar JSON": snapshot acumulado (+ latência por caminho) em
+ *   Documents/osccb-metrics-*.json
+ * - "Gravar trace": liga o Trace; ao desligar, salva osccb-trace-*.json
+ * - "Gravar OSC": captura RX/TX em osccb-capture-*.osccap (replay: --replay)
+ */
+
+class StatsPanel : public QWidget
+{
+    Q_OBJECT
+public:
+    explicit StatsPanel(QWidget* parent = nullptr);
+
+    // latência por caminho (tabela + JSON) e gravação de tráfego; opcional
+    void setOscClient(OscClient* osc);
+
+public slots:
+    void refresh();
+    void dumpJson();
+    void toggleTrace(bool on);
+    void toggleCapture(bool on);
+
+protected:
+    void showEvent(QShowEvent* e) override;
+    void hideEvent(QHideEvent* e) override;
+
+private:
+    QPlainTextEdit*   m_text = nullptr;
+    QPushButton*      m_dump = nullptr;
+    QPushButton*      m_trace = nullptr;
+    QPushButton*      m_capture = nullptr;
+    QTimer            m_timer;
+    Metrics::Snapshot m_prev;
+    OscClient*        m_osc = nullptr;
+    const RttTracker* m_rtt = nullptr;
+};
@@ -0,0 +1,147 @@
+#include "trace.h"
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QVector>
+#include <QFile>
+#include <QTextStream>
+#include <QThread>
+#include <QCoreApplication>
+
+std::atomic<bool> Trace::s_enabled{false};
+
+namespace {
+
+struct Event {
+    const char* name;
+    qint64      startNs;
+    qint64      durNs;     // < 0 = instantâneo
+    qint64      id;        // < 0 = sem args
+};
+
+struct ThreadBuffer {
+    std::atomic<quint64> head{0};   // total gravado (índice = head % capacidade)
+    quint64 dumped = 0;             // head do último despejo (sob registryMutex)
+    Event   ev[Trace::kEventsPerThread];
+    int     tid = 0;
+    QString threadName;
+};
+
+QMutex& registryMutex() { static QMutex m; return m; }
+QVector<ThreadBuffer*>& registry() { static QVector<ThreadBuffer*> v; return v; }
+
+// Buffers não são liberados ao fim da thread (poucas threads; o trace continua válido)
+ThreadBuffer* registerThread()
+{
+    auto* b = new ThreadBuffer;
+    QThread* t = QThread::currentThread();
+    const bool isUi = QCoreApplication::instance() && t == QCoreApplication::instance()->thread();
+    QMutexLocker lock(&registryMutex());
+    b->tid = registry().size() + 1;
+    b->threadName = isUi ? QStringLiteral("ui")
+                         : (t && !t->objectName().isEmpty() ? t->objectName()
+                                                            : QStringLiteral("thread-%1").arg(b->tid));
+    registry().append(b);
+    return b;
+}
+
+ThreadBuffer& threadBuffer()
+{
+    static thread_local ThreadBuffer* b = registerThread();
+    return *b;
+}
+
+inline void push(const Event& e)
+{
+    ThreadBuffer& b = threadBuffer();
+    const quint64 h = b.head.load(std::memory_order_relaxed);
+    b.ev[h & (Trace::kEventsPerThread - 1)] = e;
+    b.head.store(h + 1, std::memory_order_release);
+}
+
+const QElapsedTimer& traceClock()
+{
+    static QElapsedTimer c = [] { QElapsedTimer t; t.start(); return t; }();
+    return c;
+}
+
+} // namespace
+
+static_assert((Trace::kEventsPerThread & (Trace::kEventsPerThread - 1)) == 0,
+              "kEventsPerThread deve ser potência de 2");
+
+void Trace::setEnabled(bool on)
+{
+    traceClock(); // fixa a origem antes do 1º evento
+    s_enabled.store(on, std::memory_order_relaxed);
+}
+
+qint64 Trace::nowNs() { return traceClock().nsecsElapsed(); }
+
+void Trace::complete(const char* name, qint64 startNs, qint64 endNs, qint64 id)
+{
+    push(Event{ name, startNs, endNs - startNs, id });
+}
+
+void Trace::instant(const char* name, qint64 id)
+{
+    push(Event{ name, nowNs(), -1, id });
+}
+
+// ============ Despejo (JSON "traceEvents") ============
+// ts/dur em µs com fração (ns preservados)
+static QString usStr(qint64 ns) { return QString::number(ns / 1000.0, 'f', 3); }
+
+// objectName da thread vem de fora: aspas, barra e controle escapados
+static QString jsonStr(const QString& s)
+{
+    QString r;
+    r.reserve(s.size());
+    for (const QChar c : s) {
+        if (c == u'"' || c == u'\\') { r += u'\\'; r += c; }
+        else if (c.unicode() < 0x20)  r += QStringLiteral("\\u%1").arg(c.unicode(), 4, 16, QChar('0'));
+        else                          r += c;
+    }
+    return r;
+}
+
+bool Trace::writeChromeJson(const QString& path)
+{
+    setEnabled(false);
+
+    QFile f(path);
+    if (!f.open(QIODevice::WriteOnly | QIODevice::Text)) return false;
+
+    QTextStream out(&f);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    auto sep = [&] { if (!first) out << ",\n"; first = false; };
+
+    // um escopo aberto antes do setEnabled(false) ainda grava ao fechar: cada
+    // evento copiado é conferido contra o head da thread (descarta o sobrescrito)
+    QMutexLocker lock(&registryMutex());
+    for (ThreadBuffer* b : registry()) {
+        sep();
+        out << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" << b->tid
+            << ",\"args\":{\"name\":\"" << jsonStr(b->threadName) << "\"}}";
+
+        const quint64 head  = b->head.load(std::memory_order_acquire);
+        const quint64 count = qMin<quint64>(head - b->dumped, quint64(kEventsPerThread));
+        b->dumped = head;                  // o próximo despejo começa daqui
+        for (quint64 k = head - count; k < head; ++k) {
+            const Event e = b->ev[k & (kEventsPerThread - 1)];
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (b->head.load(std::memory_order_relaxed) >= k + kEventsPerThread) continue;
+            sep();
+            out << "{\"name\":\"" << e.name << "\",\"cat\":\"osccb\",\"pid\":1,\"tid\":" << b->tid
+                << ",\"ts\":" << usStr(e.startNs);
+            if (e.durNs >= 0) out << ",\"ph\":\"X\",\"dur\":" << usStr(e.durNs);
+            else              out << ",\"ph\":\"i\",\"s\":\"t\"";
+            if (e.id >= 0)    out << ",\"args\":{\"id\":" << e.id << '}';
+            out << '}';
+        }
+    }
+    out << "\n]}\n";
+    out.flush();
+    return out.status() == QTextStream::Ok;
+}
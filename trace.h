@@ -0,0 +1,57 @@
+#pragma once
+#include <QtGlobal>
+#include <QString>
+#include <atomic>
+
+/*
+ * Trace — eventos de tempo no formato Chrome trace (chrome://tracing / Perfetto)
+ * - Opt-in: desligado não custa mais que a leitura de um atomic<bool>
+ *   (liga por OSCCB_TRACE=1 no ambiente ou pelo botão da aba Config)
+ * - Cada thread grava no seu próprio anel (thread_local, sem lock); ao
+ *   encher, sobrescreve o mais antigo: o trace guarda os últimos segundos
+ * - Nomes são literais (const char*), guardados só como ponteiro
+ * - writeChromeJson() para a gravação antes de despejar e grava só o que
+ *   veio depois do despejo anterior
+ *
+ * Uso:
+ *   TRACE_SCOPE("osc.send");            // duração do escopo
+ *   TRACE_SCOPE_ID("ui.flushFader", ch); // idem, com args.id
+ *   TRACE_INSTANT("ui.sendTimer.arm", ch);
+ */
+
+class Trace
+{
+public:
+    static constexpr int kEventsPerThread = 1 << 16;
+
+    static bool enabled() { return s_enabled.load(std::memory_order_relaxed); }
+    static void setEnabled(bool on);
+
+    static qint64 nowNs();
+    static void complete(const char* name, qint64 startNs, qint64 endNs, qint64 id);
+    static void instant(const char* name, qint64 id);
+
+    static bool writeChromeJson(const QString& path);
+
+    class Scope {
+    public:
+        explicit Scope(const char* name, qint64 id = -1)
+            : m_name(Trace::enabled() ? name : nullptr), m_id(id),
+              m_start(m_name ? Trace::nowNs() : 0) {}
+        ~Scope() { if (m_name) Trace::complete(m_name, m_start, Trace::nowNs(), m_id); }
+        Q_DISABLE_COPY(Scope)
+    private:
+        const char* m_name;
+        qint64      m_id;
+        qint64      m_start;
+    };
+
+private:
+    static std::atomic<bool> s_enabled;
+};
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b)  TRACE_CONCAT_(a, b)
+#define TRACE_SCOPE(name)         Trace::Scope TRACE_CONCAT(_traceScope, __LINE__)(name)
+#define TRACE_SCOPE_ID(name, id)  Trace::Scope TRACE_CONCAT(_traceScope, __LINE__)(name, qint64(id))
+#define TRACE_INSTANT(name, id)   do { if (Trace::enabled()) Trace::instant(name, qint64(id)); } while (0)
@@ -13,25 +13,60 @@ ANDROID_TARGET_SDK_VERSION = 35
 # ====================================================================
 
 SOURCES += \
+    logbuffer.cpp \
+    logmodel.cpp \
     main.cpp \
     mainwindow.cpp \
+    metrics.cpp \
+    mixersessions.cpp \
     modernbutton.cpp \
     moderncombobox.cpp \
     moderndial.cpp \
     modernprogressbar.cpp \
+    numericreadout.cpp \
+    osccapture.cpp \
+    osccbstyle.cpp \
     oscclient.cpp \
-    titledialog.cpp
+    oscproxy.cpp \
+    rtttracker.cpp \
+    scenemorph.cpp \
+    scenestore.cpp \
+    showfile.cpp \
+    stateexport.cpp \
+    statspanel.cpp \
+    titledialog.cpp \
+    trace.cpp
 
 HEADERS += \
+    logbuffer.h \
+    logmodel.h \
     mainwindow.h \
+    meterdecode.h \
+    metrics.h \
+    mixermodel.h \
+    mixersessions.h \
     modernbutton.h \
     moderncombobox.h \
     moderndial.h \
     modernprogressbar.h \
+    numericreadout.h \
+    osccapture.h \
+    osccbstyle.h \
+    osccb_shm.h \
     oscclient.h \
-    titledialog.h
+    oscproxy.h \
+    rtttracker.h \
+    scenemorph.h \
+    scenestore.h \
+    showfile.h \
+    stateexport.h \
+    statspanel.h \
+    titledialog.h \
+    trace.h
 
 FORMS += \
+    helptab.ui \
+    logstab.ui \
     mainwindow.ui
 
 RESOURCES += \